@@ -2,8 +2,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
-#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 #include "format.hpp"
 #include "tuple.hpp"
@@ -13,14 +16,23 @@
 
 #include "detail/function_reference.hpp"
 #include "detail/io/immediate_process.hpp"
+#include "detail/size_table.hpp"
 #include "detail/static_error.hpp"
+#include "detail/type_traits/conjunction.hpp"
 #include "detail/type_traits/flatten_tuple.hpp"
 #include "detail/type_traits/input_tuple.hpp"
+#include "detail/type_traits/is_array_view.hpp"
 #include "detail/type_traits/require.hpp"
 #include "detail/type_traits/signature.hpp"
+#include "detail/wire_format.hpp"
 
 // IWYU pragma: no_include "upd/detail/value_h.hpp"
 
+#ifndef UPD_ACTION_STORAGE_SIZE
+//! \brief Size in bytes of the largest callback that `upd::action` instances store without dynamic allocation
+#define UPD_ACTION_STORAGE_SIZE (2 * sizeof(void *))
+#endif // UPD_ACTION_STORAGE_SIZE
+
 namespace upd {
 namespace detail {
 
@@ -31,41 +43,217 @@ using src_t = abstract_function<byte_t()>;
 using dest_t = abstract_function<void(byte_t)>;
 
 //! \brief Serialize `value` as a sequence of byte then call `dest` on every byte of that sequence
-template<endianess Endianess, signed_mode Signed_Mode, typename T, UPD_REQUIREMENT(not_tuple, T)>
-void insert(dest_t &dest, const T &value) {
+template<endianess Endianess, signed_mode Signed_Mode, typename Dest, typename T, UPD_REQUIREMENT(not_tuple, T)>
+void insert(Dest &dest, const T &value) {
   using namespace upd;
 
   auto output = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, value);
-  for (byte_t byte : output)
-    dest(byte);
+  wire_format<decltype(output)>::emit(output.begin(), dest);
+}
+
+//! \brief Invoke `ftor` on the values held by `view` followed by `outputs...`
+template<typename View, typename F, typename... Ts, std::size_t... Is, typename... Outputs>
+return_t<F> invoke_on_values_impl(const View &view,
+                                  F &&ftor,
+                                  tlist_t<Ts...>,
+                                  index_sequence<Is...>,
+                                  Outputs &&...outputs) {
+  return UPD_FWD(ftor)(normalize<Ts>(view.template get<Is>())..., UPD_FWD(outputs)...);
+}
+
+//! \copydoc invoke_on_values_impl
+template<typename View, typename F, typename... Ts, typename... Outputs>
+return_t<F> invoke_on_values(const View &view, F &&ftor, tlist_t<Ts...> types, Outputs &&...outputs) {
+  return invoke_on_values_impl(
+      view, UPD_FWD(ftor), types, make_index_sequence<sizeof...(Ts)>{}, UPD_FWD(outputs)...);
+}
+
+//! \brief Invoke `ftor` on the arguments serialized in `input`
+//!
+//! The arguments are unserialized in place through a \ref<tuple_view> tuple_view instance bound to `input`. If `ftor`
+//! accepts such a view as its only input parameter, the view is passed as is and nothing is unserialized beforehand.
+//! `outputs...` are passed after the arguments.
+template<typename Tuple, typename F, typename... Outputs, UPD_REQUIREMENT(is_void, handler_view_t<F>)>
+return_t<F> invoke_from(const byte_t *input, F &&ftor, Outputs &&...outputs) {
+  auto view =
+      make_view_from_typelist<Tuple::storage_endianess, Tuple::storage_signed_mode>(input, typename Tuple::types_t{});
+
+  return invoke_on_values(view, UPD_FWD(ftor), typename Tuple::types_t{}, UPD_FWD(outputs)...);
+}
+
+//! \copydoc invoke_from
+template<typename Tuple, typename F, typename... Outputs, UPD_REQUIREMENT(not_void, handler_view_t<F>)>
+return_t<F> invoke_from(const byte_t *input, F &&ftor, Outputs &&...outputs) {
+  using view_t = handler_view_t<F>;
+  static_assert(view_t::storage_endianess == Tuple::storage_endianess &&
+                    view_t::storage_signed_mode == Tuple::storage_signed_mode,
+                UPD_ERROR_SERIALIZATION_MISMATCH(F));
+
+  return UPD_FWD(ftor)(view_t{input}, UPD_FWD(outputs)...);
 }
 
+//! \brief Type of the output view of `F`, checked against the serialization parameters of `Tuple`
+template<typename Tuple, typename F>
+struct checked_output_view {
+  using type = output_view_t<F>;
+
+  static_assert(std::is_void<return_t<F>>::value, "Callbacks writing into an output view must return `void`");
+  static_assert(type::storage_endianess == Tuple::storage_endianess &&
+                    type::storage_signed_mode == Tuple::storage_signed_mode,
+                UPD_ERROR_SERIALIZATION_MISMATCH(F));
+};
+
+//! \brief Indicates whether `F` unserializes some of its parameters only once invoked
+//!
+//! Such callbacks must not write into their output view while it overlaps with their payload.
+template<typename F, typename S = parameters_signature_t<F>>
+struct reads_lazily;
+template<typename F, typename R, typename... Args>
+struct reads_lazily<F, R(Args...)>
+    : std::integral_constant<
+          bool,
+          !std::is_void<handler_view_t<F>>::value ||
+              !conjunction<std::integral_constant<bool, !is_array_view<remove_cv_ref_t<Args>>::value>...>::value> {};
+
 //! \brief Invoke `ftor` on the unserialized arguments from `src` and write the serialized return value to `dest`
 template<typename Tuple, typename F>
 void call(src_t &src, F &&ftor) {
-  Tuple input_args;
-  for (auto &byte : input_args)
-    byte = src();
+  Tuple input_args{uninitialized};
+  wire_format<Tuple>::load(src, input_args.begin());
   input_args.invoke(FWD(ftor));
 }
 
 //! \copydoc call
-template<typename Tuple, typename F, UPD_REQUIREMENT(is_void, detail::return_t<F>)>
-void call(src_t &src, dest_t &, F &&ftor) {
-  Tuple input_args;
-  for (auto &byte : input_args)
-    byte = src();
-  input_args.invoke(UPD_FWD(ftor));
+template<typename Tuple,
+         typename Src,
+         typename Dest,
+         typename F,
+         UPD_REQUIREMENT(input_invocable, Src &),
+         UPD_REQUIREMENT(is_void, detail::return_t<F>),
+         UPD_REQUIREMENT(is_void, output_view_t<F>)>
+void call(Src &src, Dest &, F &&ftor) {
+  Tuple input_args{uninitialized};
+  wire_format<Tuple>::load(src, input_args.begin());
+  invoke_from<Tuple>(input_args.begin(), UPD_FWD(ftor));
+}
+
+//! \copydoc call
+template<typename Tuple,
+         typename Src,
+         typename Dest,
+         typename F,
+         UPD_REQUIREMENT(input_invocable, Src &),
+         UPD_REQUIREMENT(not_void, detail::return_t<F>)>
+void call(Src &src, Dest &dest, F &&ftor) {
+  Tuple input_args{uninitialized};
+  wire_format<Tuple>::load(src, input_args.begin());
+
+  return insert<Tuple::storage_endianess, Tuple::storage_signed_mode>(
+      dest, invoke_from<Tuple>(input_args.begin(), UPD_FWD(ftor)));
 }
 
 //! \copydoc call
+//!
+//! This overload accepts callbacks writing their result into an output view.
+template<typename Tuple,
+         typename Src,
+         typename Dest,
+         typename F,
+         UPD_REQUIREMENT(input_invocable, Src &),
+         UPD_REQUIREMENT(not_void, output_view_t<F>)>
+void call(Src &src, Dest &dest, F &&ftor) {
+  using view_t = typename checked_output_view<Tuple, F>::type;
+
+  Tuple input_args{uninitialized};
+  wire_format<Tuple>::load(src, input_args.begin());
+
+  flatten_tuple_t<Tuple::storage_endianess, Tuple::storage_signed_mode, message_return_t<F>> output;
+  invoke_from<Tuple>(input_args.begin(), UPD_FWD(ftor), view_t{output.begin()});
+  wire_format<decltype(output)>::emit(output.begin(), dest);
+}
+
+//! \brief Invoke `ftor` on the arguments unserialized from the storage `input` and write the serialized return value to
+//! `output`
+//!
+//! The arguments are read in place, without copying the payload beforehand, and the return value is serialized
+//! directly into `output`. `input` must hold the whole payload and `output` must be large enough to hold the serialized
+//! return value.
+//!
+//! \return the number of bytes written to `output`
+template<typename Tuple,
+         typename F,
+         UPD_REQUIREMENT(is_void, detail::return_t<F>),
+         UPD_REQUIREMENT(is_void, output_view_t<F>)>
+std::size_t call_in_place(const byte_t *input, byte_t *, F &&ftor) {
+  invoke_from<Tuple>(input, UPD_FWD(ftor));
+
+  return 0;
+}
+
+//! \copydoc call_in_place(const byte_t*, byte_t*, F&&)
 template<typename Tuple, typename F, UPD_REQUIREMENT(not_void, detail::return_t<F>)>
-void call(src_t &src, dest_t &dest, F &&ftor) {
-  Tuple input_args;
-  for (auto &byte : input_args)
-    byte = src();
+std::size_t call_in_place(const byte_t *input, byte_t *output, F &&ftor) {
+  using view_t =
+      tuple_view<byte_t *, Tuple::storage_endianess, Tuple::storage_signed_mode, remove_cv_ref_t<return_t<F>>>;
+
+  view_t{output}.template set<0>(invoke_from<Tuple>(input, UPD_FWD(ftor)));
+
+  return view_t::size;
+}
+
+//! \copydoc call_in_place(const byte_t*, byte_t*, F&&)
+//!
+//! This overload accepts callbacks writing their result into an output view, which is then bound to `output`. If the
+//! callback reads its parameters lazily and `output` overlaps the payload (e.g. in a single buffered dispatcher), the
+//! payload is copied beforehand.
+template<typename Tuple, typename F, UPD_REQUIREMENT(not_void, output_view_t<F>)>
+std::size_t call_in_place(const byte_t *input, byte_t *output, F &&ftor) {
+  using view_t = typename checked_output_view<Tuple, F>::type;
+
+  if (reads_lazily<F>::value && output < input + Tuple::size && input < output + view_t::size) {
+    Tuple input_args{uninitialized};
+    std::copy(input, input + Tuple::size, input_args.begin());
+    invoke_from<Tuple>(input_args.begin(), UPD_FWD(ftor), view_t{output});
+  } else {
+    invoke_from<Tuple>(input, UPD_FWD(ftor), view_t{output});
+  }
+
+  return view_t::size;
+}
+
+//! \name
+//! \brief Invoke `ftor` on a payload whose wire representation is held by `input`
+//!
+//! Payloads holding variable-length values are expanded into a local storage beforehand.
+//! @{
+
+template<typename Tuple, typename F>
+std::size_t call_from_wire(const byte_t *input, byte_t *output, F &&ftor, std::false_type) {
+  return call_in_place<Tuple>(input, output, UPD_FWD(ftor));
+}
+template<typename Tuple, typename F>
+std::size_t call_from_wire(const byte_t *input, byte_t *output, F &&ftor, std::true_type) {
+  Tuple input_args{uninitialized};
+  wire_format<Tuple>::expand(input, input_args.begin());
+
+  return call_in_place<Tuple>(input_args.begin(), output, UPD_FWD(ftor));
+}
+
+//! @}
+
+//! \brief Invoke `ftor` on the arguments unserialized from `input` and write the serialized return value to `output`
+//!
+//! `input` must hold the whole payload as it has been received and `output` must be large enough to hold the storage of
+//! the return value. The arguments are read in place, unless some of them are variable-length values, and the return
+//! value is serialized directly into `output`, then compacted in place if it is a variable-length value.
+//!
+//! \return the number of bytes of the return value written to `output`
+template<typename Tuple, typename F>
+std::size_t call(const byte_t *input, byte_t *output, F &&ftor) {
+  using output_t = flatten_tuple_t<Tuple::storage_endianess, Tuple::storage_signed_mode, message_return_t<F>>;
 
-  return insert<Tuple::storage_endianess, Tuple::storage_signed_mode>(dest, input_args.invoke(UPD_FWD(ftor)));
+  auto written = call_from_wire<Tuple>(input, output, UPD_FWD(ftor), has_variable_length<Tuple>{});
+  return has_variable_length<output_t>::value ? wire_format<output_t>::compact(output, output) : written;
 }
 
 //! \brief Implementation of the `action` class behaviour
@@ -85,9 +273,12 @@ struct action_model_impl {
 struct action_concept {
   virtual ~action_concept() = default;
   virtual void operator()(src_t &&, dest_t &&) = 0;
+  virtual std::size_t operator()(const byte_t *, byte_t *) = 0;
+  virtual std::size_t input_size() const = 0;
+  virtual std::size_t output_size() const = 0;
 
-  std::size_t input_size;
-  std::size_t output_size;
+  //! \brief Move-construct the object into `storage` and return the address of the new object
+  virtual action_concept *move_to(void *storage) noexcept = 0;
 };
 
 //! \brief Derived class used for setting up type erasure in the `action` class
@@ -105,63 +296,121 @@ class action_model : public action_concept {
   using tuple_t = typename impl_t::tuple_t;
 
 public:
-  explicit action_model(F &&ftor) : m_impl{UPD_FWD(ftor)} {
-    action_model::input_size = tuple_t::size;
-    action_model::output_size = flatten_tuple_t<Endianess, Signed_Mode, return_t<F>>::size;
-  }
+  explicit action_model(F &&ftor) : m_impl{UPD_FWD(ftor)} {}
 
   void operator()(src_t &&src, dest_t &&dest) final { return detail::call<tuple_t>(src, dest, UPD_FWD(m_impl.ftor)); }
 
+  std::size_t operator()(const byte_t *input, byte_t *output) final {
+    return detail::call<tuple_t>(input, output, UPD_FWD(m_impl.ftor));
+  }
+
+  std::size_t input_size() const final { return tuple_t::size; }
+
+  std::size_t output_size() const final {
+    return flatten_tuple_t<Endianess, Signed_Mode, message_return_t<F>>::size;
+  }
+
+  action_concept *move_to(void *storage) noexcept final { return new (storage) action_model{std::move(*this)}; }
+
 private:
   impl_t m_impl;
 };
 
 //! \brief Wrap a callback with static storage duration or a free function into another free function
-//!
-//! This overload accepts any callback returning `void`.
-template<endianess Endianess, signed_mode Signed_Mode, typename F, F Ftor, UPD_REQUIREMENT(is_void, return_t<F>)>
+template<endianess Endianess, signed_mode Signed_Mode, typename F, F Ftor>
 void static_storage_duration_callback_wrapper(src_t &&src, dest_t &&dest) {
-  input_tuple<Endianess, Signed_Mode, F> parameters_tuple;
-  for (auto &byte : parameters_tuple)
-    byte = src();
-  parameters_tuple.invoke(Ftor);
+  detail::call<input_tuple<Endianess, Signed_Mode, F>>(src, dest, Ftor);
 }
 
 //! \copybrief static_storage_duration_callback_wrapper
 //!
-//! This overload accepts any callback not returning `void`.
-template<endianess Endianess, signed_mode Signed_Mode, typename F, F Ftor, UPD_REQUIREMENT(not_void, return_t<F>)>
-void static_storage_duration_callback_wrapper(src_t &&src, dest_t &&dest) {
-  input_tuple<Endianess, Signed_Mode, F> parameters_tuple;
-  for (auto &byte : parameters_tuple)
-    byte = src();
-  auto return_tuple = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, parameters_tuple.invoke(Ftor));
-  for (auto byte : return_tuple)
-    dest(byte);
+//! This overload reads the parameters from a contiguous input buffer and writes the return value into a contiguous
+//! output buffer.
+template<endianess Endianess, signed_mode Signed_Mode, typename F, F Ftor>
+std::size_t static_storage_duration_callback_wrapper(const byte_t *input, byte_t *output) {
+  return detail::call<input_tuple<Endianess, Signed_Mode, F>>(input, output, Ftor);
 }
 
+//! \brief Entry points and payload sizes of a callback with static storage duration
+struct static_action_info {
+  void (*wrapper)(src_t &&, dest_t &&);
+  std::size_t (*buffer_wrapper)(const byte_t *, byte_t *);
+  std::size_t input_size, output_size;
+};
+
+//! \brief Holds the `static_action_info` instance describing `Ftor`
+//!
+//! Since there is exactly one instance per callback, actions may refer to it rather than storing its content.
+template<endianess Endianess, signed_mode Signed_Mode, typename F, F Ftor>
+struct static_action_info_holder {
+  constexpr static static_action_info value = {
+      static_storage_duration_callback_wrapper<Endianess, Signed_Mode, F, Ftor>,
+      static_storage_duration_callback_wrapper<Endianess, Signed_Mode, F, Ftor>,
+      input_size<Endianess, Signed_Mode, F>::value,
+      output_size<Endianess, Signed_Mode, F>::value};
+};
+
+template<endianess Endianess, signed_mode Signed_Mode, typename F, F Ftor>
+constexpr static_action_info static_action_info_holder<Endianess, Signed_Mode, F, Ftor>::value;
+
 } // namespace detail
 
 //! \brief Wrapper around a callback which serialize / unserialize parameters and return values
 //!
-//! Given a byte sequence generated by a \ref<key> key instance, an \ref<action> action instance (whose underlying
-//! callback has the same signature as the aforesaid \ref<key> key instance) is able to unserialize the parameters from
-//! that byte sequence, invoke the underlying callback and serialize the return value as a byte sequence (which can
-//! later be unserialized by the same \ref<key> key instance to obtain the return value).
-class action : public detail::immediate_process<action, void> {
+//! Given a byte sequence generated by a \ref<key> key instance, an \ref<inplace_action> inplace_action instance (whose
+//! underlying callback has the same signature as the aforesaid \ref<key> key instance) is able to unserialize the
+//! parameters from that byte sequence, invoke the underlying callback and serialize the return value as a byte sequence
+//! (which can later be unserialized by the same \ref<key> key instance to obtain the return value).
+//!
+//! Callbacks whose size does not exceed `Storage_Size` bytes are stored inside the object itself, so wrapping them or
+//! replacing them does not involve any dynamic allocation. Larger callbacks are allocated on the heap.
+//!
+//! \tparam Storage_Size Size in bytes of the largest callback which can be stored in place
+template<std::size_t Storage_Size>
+class inplace_action : public detail::immediate_process<inplace_action<Storage_Size>, void> {
+  constexpr static auto alignment = alignof(detail::action_concept);
+  constexpr static auto buffer_size =
+      (sizeof(detail::action_concept) + Storage_Size + alignment - 1) / alignment * alignment;
+
+  template<typename Model>
+  using fits_in_place = std::integral_constant<bool,
+                                               sizeof(Model) <= buffer_size && alignof(Model) <= alignment &&
+                                                   std::is_nothrow_move_constructible<Model>::value>;
+
 public:
-  action() = default;
+  //! \brief Size in bytes of the largest callback which can be stored in place
+  constexpr static auto storage_size = Storage_Size;
+
+  inplace_action() = default;
 
   //! \brief Wrap a copy of a provided callback
   //! \tparam Endianess, Signed_Mode Serialization parameters
   //! \param ftor Callback to be wrapped
   template<endianess Endianess, signed_mode Signed_Mode, typename F, UPD_REQUIREMENT(invocable, F)>
-  explicit action(F &&ftor, endianess_h<Endianess>, signed_mode_h<Signed_Mode>)
-      : m_concept_uptr{new detail::action_model<F, Endianess, Signed_Mode>{UPD_FWD(ftor)}} {}
+  explicit inplace_action(F &&ftor, endianess_h<Endianess>, signed_mode_h<Signed_Mode>)
+      : m_concept_ptr{make_model<detail::action_model<F, Endianess, Signed_Mode>>(UPD_FWD(ftor))} {}
+
+  UPD_SFINAE_FAILURE_CTOR(inplace_action, UPD_ERROR_NOT_INVOCABLE(ftor))
+
+  //! \brief Take over the callback of another action, leaving it empty
+  inplace_action(inplace_action &&other) noexcept : m_concept_ptr{other.release_into(m_storage)} {}
+
+  //! \copydoc inplace_action(inplace_action&&)
+  inplace_action &operator=(inplace_action &&other) noexcept {
+    if (this != &other) {
+      reset();
+      m_concept_ptr = other.release_into(m_storage);
+    }
+
+    return *this;
+  }
 
-  UPD_SFINAE_FAILURE_CTOR(action, UPD_ERROR_NOT_INVOCABLE(ftor))
+  inplace_action(const inplace_action &) = delete;
+  inplace_action &operator=(const inplace_action &) = delete;
 
-  using detail::immediate_process<action, void>::operator();
+  ~inplace_action() { reset(); }
+
+  using detail::immediate_process<inplace_action<Storage_Size>, void>::operator();
 
   //! \brief Invoke the managed callback
   //!
@@ -174,8 +423,8 @@ public:
   //! \param dest Byte putter
   template<typename Src, typename Dest, UPD_REQUIREMENT(input_invocable, Src), UPD_REQUIREMENT(output_invocable, Dest)>
   void operator()(Src &&src, Dest &&dest) const {
-    if (m_concept_uptr)
-      (*m_concept_uptr)(detail::make_function_reference(src), detail::make_function_reference(dest));
+    if (m_concept_ptr)
+      (*m_concept_ptr)(detail::make_function_reference(src), detail::make_function_reference(dest));
   }
 
   UPD_SFINAE_FAILURE_MEMBER(operator(), UPD_ERROR_NOT_INPUT(src) " OR " UPD_ERROR_NOT_OUTPUT(dest))
@@ -187,23 +436,83 @@ public:
     operator()(UPD_FWD(input), [](byte_t) {});
   }
 
+  //! \brief Invoke the managed callback on a contiguous payload
+  //!
+  //! The parameters are unserialized in a single pass from `input`, which must hold the whole payload (at most
+  //! input_size() bytes). After the callback invocation, the result is serialized into `output`, which must be able to
+  //! hold at least output_size() bytes.
+  //!
+  //! \param input Beginning of the payload
+  //! \param output Beginning of the buffer receiving the serialized result
+  //! \return the number of bytes written to `output`
+  std::size_t call(const byte_t *input, byte_t *output) const {
+    return m_concept_ptr ? (*m_concept_ptr)(input, output) : 0;
+  }
+
   //! \brief Get the size in bytes of the payload needed to invoke the wrapped callback
+  //!
+  //! If the callback has variable-length parameters, the payload may be shorter than this size.
+  //!
   //! \return The size of the payload in bytes
-  std::size_t input_size() const { return m_concept_uptr->input_size; }
+  std::size_t input_size() const { return m_concept_ptr->input_size(); }
 
   //! \brief Get the size in bytes of the payload representing the return value of the wrapped callback
   //! \return The size of the payload in bytes
-  std::size_t output_size() const { return m_concept_uptr->output_size; }
+  std::size_t output_size() const { return m_concept_ptr->output_size(); }
+
+  //! \brief Check whether the wrapped callback is stored in place
+  bool is_stored_in_place() const { return m_concept_ptr && m_concept_ptr == in_place_concept(); }
 
 private:
-  std::unique_ptr<detail::action_concept> m_concept_uptr;
+  template<typename Model, typename F, UPD_REQUIRE(fits_in_place<Model>::value)>
+  detail::action_concept *make_model(F &&ftor) {
+    return new (m_storage) Model{UPD_FWD(ftor)};
+  }
+
+  template<typename Model, typename F, UPD_REQUIRE(!fits_in_place<Model>::value)>
+  detail::action_concept *make_model(F &&ftor) {
+    return new Model{UPD_FWD(ftor)};
+  }
+
+  const detail::action_concept *in_place_concept() const {
+    return static_cast<const detail::action_concept *>(static_cast<const void *>(m_storage));
+  }
+
+  detail::action_concept *release_into(void *storage) noexcept {
+    auto *concept_ptr = m_concept_ptr;
+
+    if (concept_ptr && concept_ptr == in_place_concept()) {
+      concept_ptr = m_concept_ptr->move_to(storage);
+      m_concept_ptr->~action_concept();
+    }
+    m_concept_ptr = nullptr;
+
+    return concept_ptr;
+  }
+
+  void reset() noexcept {
+    if (m_concept_ptr == in_place_concept())
+      m_concept_ptr->~action_concept();
+    else
+      delete m_concept_ptr;
+    m_concept_ptr = nullptr;
+  }
+
+  alignas(alignment) byte_t m_storage[buffer_size];
+  detail::action_concept *m_concept_ptr = nullptr;
 };
 
+//! \brief Action able to store any callback, small callbacks being stored in place
+//!
+//! Callbacks no larger than `UPD_ACTION_STORAGE_SIZE` bytes do not cause any dynamic allocation.
+using action = inplace_action<UPD_ACTION_STORAGE_SIZE>;
+
 //! \brief Action which does not manage storage for its underlying callback
 //!
 //! \ref<no_storage_action> no_storage_action instances must be given a free function or a callback with static storage
 //! duration, which makes them less permissive than \ref<action> action instances. On the other hand, they do not rely
-//! on dynamic allocation, which can be useful for embedded software.
+//! on dynamic allocation, which can be useful for embedded software. An instance only holds a pointer to a constant
+//! descriptor of its callback.
 class no_storage_action : public detail::immediate_process<no_storage_action, void> {
 public:
   using detail::immediate_process<no_storage_action, void>::operator();
@@ -213,25 +522,26 @@ public:
   //! \tparam Endianess, Signed_Mode Serialization parameters
   template<typename F, F Ftor, endianess Endianess, signed_mode Signed_Mode>
   explicit no_storage_action(unevaluated<F, Ftor>, endianess_h<Endianess>, signed_mode_h<Signed_Mode>)
-      : m_wrapper{detail::static_storage_duration_callback_wrapper<Endianess, Signed_Mode, F, Ftor>},
-        m_input_size{detail::parameters_size<F>::value}, m_output_size{detail::return_type_size<F>::value} {}
+      : m_info_ptr{&detail::static_action_info_holder<Endianess, Signed_Mode, F, Ftor>::value} {}
 
   //! \copydoc action::operator()()
   template<typename Src, typename Dest, UPD_REQUIREMENT(input_invocable, Src), UPD_REQUIREMENT(output_invocable, Dest)>
   void operator()(Src &&src, Dest &&dest) const {
-    m_wrapper(detail::make_function_reference(src), detail::make_function_reference(dest));
+    m_info_ptr->wrapper(detail::make_function_reference(src), detail::make_function_reference(dest));
   }
 
+  //! \copydoc action::call
+  std::size_t call(const byte_t *input, byte_t *output) const { return m_info_ptr->buffer_wrapper(input, output); }
+
   //! \copydoc action::input_size
-  std::size_t input_size() const { return m_input_size; }
+  std::size_t input_size() const { return m_info_ptr->input_size; }
 
   //! \copydoc action::output_size
-  std::size_t output_size() const { return m_output_size; }
+  std::size_t output_size() const { return m_info_ptr->output_size; }
 
   UPD_SFINAE_FAILURE_MEMBER(operator(), UPD_ERROR_NOT_INPUT(src) " OR " UPD_ERROR_NOT_OUTPUT(dest))
 
 private:
-  void (*m_wrapper)(detail::src_t &&, detail::dest_t &&);
-  std::size_t m_input_size, m_output_size;
+  const detail::static_action_info *m_info_ptr;
 };
 } // namespace upd
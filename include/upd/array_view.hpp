@@ -0,0 +1,138 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+#include "detail/serialization.hpp"
+#include "format.hpp"
+#include "type.hpp"
+
+namespace upd {
+
+//! \brief Lazy view of a serialized array
+//!
+//! An array view is bound to the serialized representation of `N` values of type `T` and unserializes an element only
+//! when it is accessed, according to its serialization parameters. Callbacks may declare a parameter of this type
+//! instead of `T[N]`: packets are built the same way, but the callback is given a view of the payload rather than a
+//! copy of the whole array. As with \ref<tuple_view> tuple_view parameters, the serialization parameters of the view
+//! must be those of the keyring.
+//!
+//! \warning Array views do not extend the lifetime of the byte sequence they are bound to.
+//!
+//! \tparam T Type of the elements
+//! \tparam N Number of elements
+//! \tparam Endianess Byte order of the elements
+//! \tparam Signed_Mode Signed integer representation of the elements
+template<typename T, std::size_t N, endianess Endianess, signed_mode Signed_Mode>
+class array_view {
+public:
+  //! \brief Type of the elements
+  using value_type = T;
+
+  //! \brief Equals the `Endianess` template parameter
+  constexpr static auto storage_endianess = Endianess;
+
+  //! \brief Equals the `Signed_Mode` template parameter
+  constexpr static auto storage_signed_mode = Signed_Mode;
+
+  //! \brief Size in bytes of the serialized representation of an element
+  constexpr static std::size_t element_size = detail::serialized_width<T>::value;
+
+  //! \brief Random access iterator unserializing the elements it is dereferenced on
+  class iterator {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = T;
+
+    iterator() = default;
+
+    //! \brief Bind the iterator to the serialized representation of an element
+    explicit iterator(const byte_t *ptr) : m_ptr{ptr} {}
+
+    T operator*() const { return detail::read_as<T, Endianess, Signed_Mode>(m_ptr); }
+    T operator[](difference_type n) const { return *(*this + n); }
+
+    iterator &operator++() { return *this += 1; }
+    iterator &operator--() { return *this -= 1; }
+    iterator operator++(int) {
+      auto retval = *this;
+      ++*this;
+      return retval;
+    }
+    iterator operator--(int) {
+      auto retval = *this;
+      --*this;
+      return retval;
+    }
+
+    iterator &operator+=(difference_type n) {
+      m_ptr += n * static_cast<difference_type>(element_size);
+      return *this;
+    }
+    iterator &operator-=(difference_type n) { return *this += -n; }
+
+    friend iterator operator+(iterator it, difference_type n) { return it += n; }
+    friend iterator operator+(difference_type n, iterator it) { return it += n; }
+    friend iterator operator-(iterator it, difference_type n) { return it -= n; }
+    friend difference_type operator-(const iterator &lhs, const iterator &rhs) {
+      return (lhs.m_ptr - rhs.m_ptr) / static_cast<difference_type>(element_size);
+    }
+
+    friend bool operator==(const iterator &lhs, const iterator &rhs) { return lhs.m_ptr == rhs.m_ptr; }
+    friend bool operator!=(const iterator &lhs, const iterator &rhs) { return lhs.m_ptr != rhs.m_ptr; }
+    friend bool operator<(const iterator &lhs, const iterator &rhs) { return lhs.m_ptr < rhs.m_ptr; }
+    friend bool operator>(const iterator &lhs, const iterator &rhs) { return lhs.m_ptr > rhs.m_ptr; }
+    friend bool operator<=(const iterator &lhs, const iterator &rhs) { return lhs.m_ptr <= rhs.m_ptr; }
+    friend bool operator>=(const iterator &lhs, const iterator &rhs) { return lhs.m_ptr >= rhs.m_ptr; }
+
+  private:
+    const byte_t *m_ptr = nullptr;
+  };
+
+  //! \copydoc iterator
+  using const_iterator = iterator;
+
+  //! \brief Bind the view to a byte sequence
+  //! \param src Start of the serialized representation of the array
+  explicit array_view(const byte_t *src) : m_src{src} {}
+
+  //! \brief Unserialize the element at the given index
+  T operator[](std::size_t i) const { return detail::read_as<T, Endianess, Signed_Mode>(m_src + i * element_size); }
+
+  //! \brief Unserialize the first element
+  T front() const { return (*this)[0]; }
+
+  //! \brief Unserialize the last element
+  T back() const { return (*this)[N - 1]; }
+
+  //! \brief Number of elements
+  constexpr static std::size_t size() { return N; }
+
+  //! \brief Start of the serialized representation of the array
+  const byte_t *data() const { return m_src; }
+
+  //! \brief Iterator to the first element
+  iterator begin() const { return iterator{m_src}; }
+
+  //! \brief Iterator past the last element
+  iterator end() const { return iterator{m_src + N * element_size}; }
+
+private:
+  const byte_t *m_src;
+};
+
+template<typename T, std::size_t N, endianess Endianess, signed_mode Signed_Mode>
+constexpr endianess array_view<T, N, Endianess, Signed_Mode>::storage_endianess;
+
+template<typename T, std::size_t N, endianess Endianess, signed_mode Signed_Mode>
+constexpr signed_mode array_view<T, N, Endianess, Signed_Mode>::storage_signed_mode;
+
+template<typename T, std::size_t N, endianess Endianess, signed_mode Signed_Mode>
+constexpr std::size_t array_view<T, N, Endianess, Signed_Mode>::element_size;
+
+} // namespace upd
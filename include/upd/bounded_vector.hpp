@@ -0,0 +1,176 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+
+#include "detail/type_traits/smallest.hpp"
+#include "type.hpp"
+#include "varint.hpp"
+
+namespace upd {
+
+//! \brief Sequence of at most `N` integers sent on the wire with as many elements as it holds
+//!
+//! Bounded vectors are serialized as their size, encoded as a \ref<varint> varint, followed by their elements. The
+//! serialization parameters apply to the elements but not to the size.
+//!
+//! It stands for a `T[N]` array. In a \ref<tuple> tuple storage, a bounded vector occupies as many bytes as if it were
+//! full, whereas a `bounded_vector<std::uint8_t, 256>` holding `20` elements is sent as `21` bytes.
+//!
+//! \note Bounded vectors cannot be array elements.
+//!
+//! \tparam T Integer type of the elements
+//! \tparam N Greatest number of elements
+template<typename T, std::size_t N>
+class bounded_vector {
+  static_assert(std::is_integral<T>::value, "Bounded vectors must hold an integer type");
+  static_assert(N > 0, "Bounded vectors must be able to hold at least one element");
+
+public:
+  //! \brief Type of the elements
+  using value_type = T;
+
+  //! \brief Type of the size sent on the wire
+  using size_type = detail::smallest_unsigned_t<N>;
+
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  //! \brief Greatest number of elements
+  constexpr static std::size_t capacity = N;
+
+  //! \brief Make an empty vector
+  bounded_vector() = default;
+
+  //! \brief Copy a sequence of elements
+  //!
+  //! Only the first `N` elements are copied if `count` is greater than `N`.
+  //!
+  //! \param values Beginning of the sequence
+  //! \param count Number of elements in the sequence
+  bounded_vector(const T *values, std::size_t count) {
+    resize(count);
+    for (std::size_t i = 0; i < m_size; i++)
+      m_values[i] = values[i];
+  }
+
+  //! \copydoc bounded_vector(const T *, std::size_t)
+  bounded_vector(std::initializer_list<T> values) : bounded_vector(values.begin(), values.size()) {}
+
+  //! \brief Number of elements
+  std::size_t size() const { return m_size; }
+
+  //! \brief Check if the vector holds no element
+  bool empty() const { return m_size == 0; }
+
+  //! \brief Change the number of elements
+  //!
+  //! Added elements are value-initialized and `count` is truncated to `N`.
+  void resize(std::size_t count) {
+    count = count < N ? count : N;
+    for (std::size_t i = m_size; i < count; i++)
+      m_values[i] = T{};
+    m_size = static_cast<size_type>(count);
+  }
+
+  //! \brief Append an element
+  //! \return `false` if the vector was already full, in which case it is left unchanged
+  bool push_back(const T &value) {
+    if (m_size == N)
+      return false;
+
+    m_values[m_size++] = value;
+    return true;
+  }
+
+  //! \brief Remove every element
+  void clear() { m_size = 0; }
+
+  T *data() { return m_values; }
+  const T *data() const { return m_values; }
+
+  iterator begin() { return m_values; }
+  iterator end() { return m_values + m_size; }
+  const_iterator begin() const { return m_values; }
+  const_iterator end() const { return m_values + m_size; }
+
+  T &operator[](std::size_t i) { return m_values[i]; }
+  const T &operator[](std::size_t i) const { return m_values[i]; }
+
+  friend bool operator==(const bounded_vector &lhs, const bounded_vector &rhs) {
+    if (lhs.m_size != rhs.m_size)
+      return false;
+
+    for (std::size_t i = 0; i < lhs.m_size; i++) {
+      if (lhs.m_values[i] != rhs.m_values[i])
+        return false;
+    }
+
+    return true;
+  }
+  friend bool operator!=(const bounded_vector &lhs, const bounded_vector &rhs) { return !(lhs == rhs); }
+
+private:
+  T m_values[N] = {};
+  size_type m_size = 0;
+};
+
+template<typename T, std::size_t N>
+constexpr std::size_t bounded_vector<T, N>::capacity;
+
+//! \brief String of at most `N` characters sent on the wire with as many characters as it holds
+//!
+//! Bounded strings are not null-terminated. They behave the same way as \ref<bounded_vector> bounded_vector instances
+//! of `char`, but can also be made from a null-terminated string.
+//!
+//! \tparam N Greatest number of characters
+template<std::size_t N>
+class bounded_string : public bounded_vector<char, N> {
+public:
+  using bounded_vector<char, N>::bounded_vector;
+
+  bounded_string() = default;
+
+  //! \brief Copy a null-terminated string
+  //!
+  //! Only the first `N` characters are copied if the string is longer.
+  bounded_string(const char *str) {
+    while (this->size() < N && str[this->size()])
+      this->push_back(str[this->size()]);
+  }
+};
+
+namespace detail {
+
+//! \brief Size in bytes of the storage of a bounded vector of type `T`
+template<typename T>
+struct bounded_vector_storage_size
+    : std::integral_constant<std::size_t,
+                             varint<typename T::size_type>::max_size +
+                                 T::capacity * sizeof(typename T::value_type)> {};
+
+//! \brief Unserialize the size of a bounded vector of type `T`, truncated to its capacity
+template<typename T>
+std::size_t read_bounded_size(const byte_t *src) {
+  std::size_t size = read_varint<typename T::size_type>(src);
+  return size < T::capacity ? size : T::capacity;
+}
+
+//! \brief Length in bytes of the serialized representation of a bounded vector of type `T`
+//!
+//! Only the first `available` bytes of `src` are inspected. If they do not hold the size of the vector, a lower bound
+//! of the length greater than `available` is returned instead.
+template<typename T>
+std::size_t bounded_vector_length(const byte_t *src, std::size_t available) {
+  auto prefix_length = varint_length<typename T::size_type>(src, available);
+  if (prefix_length > available)
+    return prefix_length;
+
+  return prefix_length + read_bounded_size<T>(src) * sizeof(typename T::value_type);
+}
+
+} // namespace detail
+} // namespace upd
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <type_traits>
 
@@ -14,13 +15,14 @@
 #include "detail/io/immediate_process.hpp"
 #include "detail/io/immediate_reader.hpp"
 #include "detail/io/immediate_writer.hpp"
+#include "detail/serialization.hpp"
+#include "detail/serialized_message.hpp"
+#include "detail/size_table.hpp"
 #include "detail/static_error.hpp"
 #include "detail/type_traits/require.hpp"
 #include "detail/type_traits/signature.hpp"
 #include "detail/type_traits/typelist.hpp"
 
-// IWYU pragma: no_forward_declare upd::detail::map_parameters_size
-
 namespace upd {
 namespace detail {
 
@@ -28,15 +30,26 @@ namespace detail {
 template<typename Keyring>
 using needed_input_buffer_size =
     std::integral_constant<std::size_t,
-                           detail::max<detail::map_parameters_size<typename Keyring::signatures_t::type>>::value +
-                               sizeof(typename Keyring::index_t)>;
+                           keyring_size_table<Keyring>::max_input_size + sizeof(typename Keyring::index_t)>;
 
 //! \brief How many bytes that would be needed to represent any action response of `Keyring`
 template<typename Keyring>
-using needed_output_buffer_size = detail::max<detail::map_parameters_size<typename Keyring::signatures_t::type>>;
+using needed_output_buffer_size = std::integral_constant<std::size_t, keyring_size_table<Keyring>::max_output_size>;
 
 } // namespace detail
 
+//! \brief Outcome of putting a sequence of bytes into a buffered dispatcher
+struct put_result {
+  //! \brief Number of bytes copied into the input buffer
+  std::size_t consumed;
+
+  //! \brief Number of packets which have been resolved
+  std::size_t resolved;
+
+  //! \brief Number of packets which have been dropped
+  std::size_t dropped;
+};
+
 //! \brief Dispatcher with input / output storage
 //!
 //! Instances of this class may store input and output byte streams while they are received or sent. This allows the
@@ -110,6 +123,22 @@ public:
 
   UPD_SFINAE_FAILURE_MEMBER(read_from, UPD_ERROR_NOT_INPUT(src))
 
+  //! \brief Put bytes held in contiguous storage into the input buffer until a full action request is stored
+  //!
+  //! Behaves as read_from(Src &&), except that the bytes are copied by chunks as large as what the packet being loaded
+  //! still needs.
+  //!
+  //! \param src Beginning of the byte sequence
+  //! \return the same as read_from(Src &&)
+  packet_status read_from_contiguous(const byte_t *src) {
+    packet_status status = packet_status::LOADING_PACKET;
+    while (!m_is_index_loaded && status == packet_status::LOADING_PACKET)
+      status = load_chunk(src);
+    while (m_is_index_loaded)
+      status = load_chunk(src);
+    return status;
+  }
+
   //! \brief Put one byte into the input buffer
   //! \copydoc Reader_CRTP
   //! \param byte Byte to put
@@ -122,32 +151,48 @@ public:
   packet_status put(byte_t byte) {
     derived().ibuf_begin()[m_ibuf_next++] = byte;
 
-    if (--m_load_count > 0)
-      return packet_status::LOADING_PACKET;
+    return --m_load_count > 0 ? packet_status::LOADING_PACKET : process_loaded_bytes();
+  }
 
-    if (m_is_index_loaded) {
-      call();
-      return packet_status::RESOLVED_PACKET;
-    } else {
-      auto *ibuf_ptr = derived().ibuf_begin();
-      auto index = get_index([&]() { return *ibuf_ptr++; });
-      if (index < m_dispatcher.size) {
-        m_load_count = m_dispatcher[index].input_size();
-        m_is_index_loaded = true;
-
-        if (m_load_count == 0) {
-          call();
-          return packet_status::RESOLVED_PACKET;
-        } else {
-          return packet_status::LOADING_PACKET;
-        }
-      } else {
-        m_is_index_loaded = false;
-        m_load_count = sizeof(index_t);
-        m_ibuf_next = 0;
-        return packet_status::DROPPED_PACKET;
+  //! \brief Put a sequence of bytes into the input buffer
+  //!
+  //! The bytes are copied into the input buffer by chunks as large as what the packet being loaded still needs, and
+  //! every packet completed in the process is resolved. Since the result of a resolved packet is written to the output
+  //! buffer, the function returns as soon as a resolved packet leaves the output buffer loaded. The remaining bytes
+  //! can then be put once the output buffer has been unloaded.
+  //!
+  //! \param bytes Beginning of the byte sequence
+  //! \param size Number of bytes in the sequence
+  //! \return a \ref<put_result> put_result instance holding how many bytes were consumed and how many packets were
+  //! resolved or dropped
+  put_result put(const byte_t *bytes, std::size_t size) {
+    put_result result{0, 0, 0};
+
+    while (result.consumed < size) {
+      auto count = std::min(m_load_count, size - result.consumed);
+      std::copy(bytes + result.consumed, bytes + result.consumed + count, derived().ibuf_begin() + m_ibuf_next);
+      result.consumed += count;
+      m_ibuf_next += count;
+      m_load_count -= count;
+
+      if (m_load_count > 0)
+        break;
+
+      switch (process_loaded_bytes()) {
+      case packet_status::RESOLVED_PACKET:
+        ++result.resolved;
+        if (is_loaded())
+          return result;
+        break;
+      case packet_status::DROPPED_PACKET:
+        ++result.dropped;
+        break;
+      case packet_status::LOADING_PACKET:
+        break;
       }
     }
+
+    return result;
   }
 
   using detail::immediate_writer<this_t>::write_to;
@@ -163,6 +208,13 @@ public:
 
   UPD_SFINAE_FAILURE_MEMBER(write_all, UPD_ERROR_NOT_OUTPUT(dest))
 
+  //! \brief Copy the output buffer content as a whole into contiguous storage
+  //! \param dest Beginning of the storage
+  void write_to_contiguous(byte_t *dest) {
+    std::copy(derived().obuf_begin() + m_obuf_next, derived().obuf_begin() + m_obuf_bottom, dest);
+    m_obuf_next = m_obuf_bottom;
+  }
+
   //! \brief Output one byte from the output buffer
   //!
   //! If the output buffer is empty, the function will return an arbitrary value.
@@ -195,6 +247,17 @@ public:
     return status;
   }
 
+  //! \brief Call read_from_contiguous() then write_to_contiguous()
+  //! \param input Beginning of the input byte sequence
+  //! \param output Beginning of the storage receiving the output buffer content
+  //! \return the \ref<packet_status> enumerator instance resulting from the read_from_contiguous() call
+  packet_status process_contiguous(const byte_t *input, byte_t *output) {
+    auto status = read_from_contiguous(input);
+    if (status == packet_status::RESOLVED_PACKET)
+      write_to_contiguous(output);
+    return status;
+  }
+
 #if __cplusplus >= 201703L
   //! \copydoc dispatcher::replace()
   template<index_t Index, auto &Ftor>
@@ -219,28 +282,43 @@ public:
   //!
   //! This function can only be used if the data in the output buffer is complete (i.e. if no call to get() has been
   //! made since the last packet resolution) and if the requested action buffer is large enough to hold all the data to
-  //! send. When this function has finished executing, the output buffer is empty.
+  //! send. The content of the output buffer is forwarded as is (padded with zeros if the requested action buffer is
+  //! larger). When this function has finished executing, the output buffer is empty.
   //!
   //! \param output Output byte stream of any kind
   //! \param k Key of the action to request on the other dispatcher
   //! \return `true` if and only if the content of the output buffer has been written to the output byte stream
   template<typename Output, typename Key, UPD_REQUIREMENT(key, typename std::decay<Key>::type)>
   bool reply(Output &&output, Key k) {
+    using buf_t = typename Key::tuple_t::template arg_t<0>;
+    static_assert(std::is_same<typename detail::array_t<buf_t>::value_type, byte_t>::value,
+                  "The requested action must accept a single byte buffer");
+
     constexpr auto buf_size = k.payload_length - sizeof k.index;
     if (!(m_obuf_next == 0 && m_obuf_bottom <= buf_size))
       return false;
 
-    using buf_t = typename Key::tuple_t::template arg_t<0>;
-
-    buf_t buf;
-    write_to(std::begin(buf));
-    k(buf).write_to(UPD_FWD(output));
+    detail::forwarded_message<Key::endianess, Key::signed_mode, typename Key::index_t, buf_size>{
+        Key::index, derived().obuf_begin(), m_obuf_bottom}
+        .write_to(UPD_FWD(output));
+    m_obuf_next = m_obuf_bottom;
 
     return true;
   }
 
   UPD_SFINAE_FAILURE_MEMBER(reply, UPD_ERROR_INVALID_KEY(key));
 
+  //! \copydoc dispatcher::dispatch_batch
+  //! \note The internal buffers are neither used nor modified.
+  batch_result dispatch_batch(const byte_t *input,
+                              std::size_t input_length,
+                              byte_t *output,
+                              std::size_t output_length,
+                              batch_entry *entries,
+                              std::size_t max_entries) const {
+    return m_dispatcher.dispatch_batch(input, input_length, output, output_length, entries, max_entries);
+  }
+
   //! \copydoc dispatcher::operator[](index_t)
   action_t &operator[](index_t index) { return m_dispatcher[index]; }
 
@@ -248,16 +326,55 @@ public:
   const action_t &operator[](index_t index) const { return m_dispatcher[index]; }
 
 private:
+  //! \brief Process the content of the input buffer once the expected number of bytes have been loaded
+  //!
+  //! Depending on what has been loaded, the action is invoked or more bytes are expected. Payloads holding
+  //! variable-length values are loaded in several steps, as their length is only known once part of them is loaded.
+  //!
+  //! \return the status of the packet being loaded
+  packet_status process_loaded_bytes() {
+    const auto *payload = derived().ibuf_begin();
+    auto index = get_index([&]() { return *payload++; });
+    if (index >= m_dispatcher.size) {
+      m_is_index_loaded = false;
+      m_load_count = sizeof(index_t);
+      m_ibuf_next = 0;
+      return packet_status::DROPPED_PACKET;
+    }
+
+    auto loaded = m_ibuf_next - sizeof(index_t);
+    auto length = m_dispatcher.input_length(index, payload, loaded);
+    m_is_index_loaded = true;
+
+    if (length > loaded) {
+      m_load_count = length - loaded;
+      return packet_status::LOADING_PACKET;
+    } else {
+      call();
+      return packet_status::RESOLVED_PACKET;
+    }
+  }
+
+  //! \brief Copy the bytes still needed by the packet being loaded into the input buffer, then process them
+  //! \param src Beginning of the bytes to copy, moved past them
+  //! \return the status of the packet being loaded
+  packet_status load_chunk(const byte_t *&src) {
+    std::copy(src, src + m_load_count, derived().ibuf_begin() + m_ibuf_next);
+    src += m_load_count;
+    m_ibuf_next += m_load_count;
+    m_load_count = 0;
+
+    return process_loaded_bytes();
+  }
+
   //! \brief Provided that the input buffer does contain a full action request, invoke the corresponding action
   //! \warning If the input buffer does not contain a valid action request, the behavior is undefined.
   void call() {
-    m_obuf_bottom = 0;
     m_obuf_next = 0;
 
-    auto *ibuf_ptr = derived().ibuf_begin();
+    const auto *ibuf_ptr = derived().ibuf_begin();
     auto index = get_index([&]() { return *ibuf_ptr++; });
-    m_dispatcher[index]([&]() { return *ibuf_ptr++; },
-                        [&](byte_t byte) { derived().obuf_begin()[m_obuf_bottom++] = byte; });
+    m_obuf_bottom = m_dispatcher[index].call(ibuf_ptr, derived().obuf_begin());
 
     m_is_index_loaded = false;
     m_load_count = sizeof(index_t);
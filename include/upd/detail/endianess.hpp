@@ -3,7 +3,13 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#endif
 
 #include "../format.hpp"
 #include "../type.hpp"
@@ -13,6 +19,75 @@
 namespace upd {
 namespace detail {
 
+//! \brief Get the endianess opposite to the provided one
+constexpr endianess opposite(endianess value) {
+  return value == endianess::LITTLE ? endianess::BIG : endianess::LITTLE;
+}
+
+//! \brief Offset of the `n` least significant bytes in the representation of an integer of `Size` bytes
+template<std::size_t Size>
+constexpr std::size_t low_bytes_offset(std::size_t n) {
+  return platform_info.endianess == endianess::BIG ? Size - n : 0;
+}
+
+//! \brief Unsigned integer type of `Size` bytes
+template<std::size_t Size>
+struct word;
+template<>
+struct word<1> {
+  using type = std::uint8_t;
+};
+template<>
+struct word<2> {
+  using type = std::uint16_t;
+};
+template<>
+struct word<4> {
+  using type = std::uint32_t;
+};
+template<>
+struct word<8> {
+  using type = std::uint64_t;
+};
+
+//! \name
+//! \brief Reverse the byte order of an unsigned integer
+//! @{
+
+inline std::uint8_t byteswap(std::uint8_t x) { return x; }
+
+inline std::uint16_t byteswap(std::uint16_t x) {
+#if defined(__GNUC__)
+  return __builtin_bswap16(x);
+#elif defined(_MSC_VER)
+  return _byteswap_ushort(x);
+#else
+  return std::uint16_t(x << 8 | x >> 8);
+#endif
+}
+
+inline std::uint32_t byteswap(std::uint32_t x) {
+#if defined(__GNUC__)
+  return __builtin_bswap32(x);
+#elif defined(_MSC_VER)
+  return _byteswap_ulong(x);
+#else
+  return std::uint32_t(byteswap(std::uint16_t(x))) << 16 | byteswap(std::uint16_t(x >> 16));
+#endif
+}
+
+inline std::uint64_t byteswap(std::uint64_t x) {
+#if defined(__GNUC__)
+  return __builtin_bswap64(x);
+#elif defined(_MSC_VER)
+  return _byteswap_uint64(x);
+#else
+  return std::uint64_t(byteswap(std::uint32_t(x))) << 32 | byteswap(std::uint32_t(x >> 32));
+#endif
+}
+
+//! @}
+
 //! \brief Platform-agnostic implementations of `from_endianess`
 template<typename T, endianess Endianess, require<Endianess == endianess::LITTLE> = 0>
 T from_endianess_impl(const byte_t *raw_data, std::size_t n) {
@@ -40,23 +115,34 @@ T from_endianess_impl(const byte_t *raw_data, std::size_t n) {
 template<typename T, endianess Endianess, UPD_REQUIRE(platform_info.endianess == Endianess)>
 T from_endianess(const byte_t *raw_data, std::size_t n) {
   auto retval = T(0);
-  memcpy(&retval, raw_data, n);
+  memcpy(reinterpret_cast<byte_t *>(&retval) + low_bytes_offset<sizeof(T)>(n), raw_data, n);
 
   return retval;
 }
-template<typename T, endianess Endianess, UPD_REQUIRE(platform_info.endianess != Endianess)>
+template<typename T, endianess Endianess, UPD_REQUIRE(platform_info.endianess == opposite(Endianess))>
+T from_endianess(const byte_t *raw_data, std::size_t n) {
+  using word_t = typename word<sizeof(T)>::type;
+
+  auto retval = word_t(0);
+  memcpy(reinterpret_cast<byte_t *>(&retval) + low_bytes_offset<sizeof(T)>(n), raw_data, n);
+
+  return T(byteswap(retval) >> 8 * (sizeof(T) - n));
+}
+template<typename T,
+         endianess Endianess,
+         UPD_REQUIRE(platform_info.endianess != Endianess && platform_info.endianess != opposite(Endianess))>
 T from_endianess(const byte_t *raw_data, std::size_t n) {
   return from_endianess_impl<T, Endianess>(raw_data, n);
 }
 
 //! \brief Platform-agnostic implementations of `to_endianess`
 template<endianess Endianess, typename T, require<Endianess == endianess::LITTLE> = 0>
-void to_endianess_impl(byte_t *raw_data, T x, std::size_t n) {
+UPD_CONSTEXPR_17 void to_endianess_impl(byte_t *raw_data, T x, std::size_t n) {
   for (std::size_t i = 0; i < n; i++, x = T(x >> 8))
     raw_data[i] = x & 0xff;
 }
 template<endianess Endianess, typename T, require<Endianess == endianess::BIG> = 0>
-void to_endianess_impl(byte_t *raw_data, T x, std::size_t n) {
+UPD_CONSTEXPR_17 void to_endianess_impl(byte_t *raw_data, T x, std::size_t n) {
   for (std::size_t i = 0; i < n; i++, x = T(x >> 8))
     raw_data[(n - i - 1)] = x & 0xff;
 }
@@ -64,9 +150,18 @@ void to_endianess_impl(byte_t *raw_data, T x, std::size_t n) {
 //! \brief Serialize an integer into a sequence of byte according to the provided endianess
 template<endianess Endianess, typename T, UPD_REQUIRE(platform_info.endianess == Endianess)>
 void to_endianess(byte_t *raw_data, const T &x, std::size_t n) {
-  memcpy(raw_data, &x, n);
+  memcpy(raw_data, reinterpret_cast<const byte_t *>(&x) + low_bytes_offset<sizeof(T)>(n), n);
+}
+template<endianess Endianess, typename T, UPD_REQUIRE(platform_info.endianess == opposite(Endianess))>
+void to_endianess(byte_t *raw_data, const T &x, std::size_t n) {
+  using word_t = typename word<sizeof(T)>::type;
+
+  auto swapped = byteswap(word_t(word_t(x) << 8 * (sizeof(T) - n)));
+  memcpy(raw_data, reinterpret_cast<const byte_t *>(&swapped) + low_bytes_offset<sizeof(T)>(n), n);
 }
-template<endianess Endianess, typename T, UPD_REQUIRE(platform_info.endianess != Endianess)>
+template<endianess Endianess,
+         typename T,
+         UPD_REQUIRE(platform_info.endianess != Endianess && platform_info.endianess != opposite(Endianess))>
 void to_endianess(byte_t *raw_data, const T &x, std::size_t n) {
   to_endianess_impl<Endianess, T>(raw_data, x, n);
 }
@@ -0,0 +1,151 @@
+//! \file
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "endianess.hpp"
+
+namespace upd {
+namespace detail {
+
+//! \name
+//! \brief Number of exponent and significand bits of the IEEE 754 binary interchange format of `Size` bytes
+//! @{
+
+template<std::size_t Size>
+struct binary_format;
+template<>
+struct binary_format<2> {
+  constexpr static int exponent_bits = 5;
+  constexpr static int significand_bits = 10;
+};
+template<>
+struct binary_format<4> {
+  constexpr static int exponent_bits = 8;
+  constexpr static int significand_bits = 23;
+};
+template<>
+struct binary_format<8> {
+  constexpr static int exponent_bits = 11;
+  constexpr static int significand_bits = 52;
+};
+
+//! @}
+
+//! \brief Encode a value in the IEEE 754 binary interchange format of `Size` bytes
+//!
+//! This is the platform-agnostic implementation, which does not rely on the representation of floating-point numbers
+//! on the platform. Values are rounded to the nearest representable value, ties to even.
+template<std::size_t Size>
+unsigned long long encode_binary(double value) {
+  constexpr int exponent_bits = binary_format<Size>::exponent_bits;
+  constexpr int significand_bits = binary_format<Size>::significand_bits;
+  constexpr unsigned long long max_exponent = (1ull << exponent_bits) - 1;
+  constexpr int bias = (1 << (exponent_bits - 1)) - 1;
+
+  unsigned long long sign = std::signbit(value) ? 1ull << (Size * 8 - 1) : 0;
+  if (std::isnan(value))
+    return sign | max_exponent << significand_bits | 1ull << (significand_bits - 1);
+
+  value = std::fabs(value);
+  if (std::isinf(value))
+    return sign | max_exponent << significand_bits;
+  if (value == 0)
+    return sign;
+
+  int exponent;
+  auto fraction = std::frexp(value, &exponent);
+  auto biased_exponent = exponent - 1 + bias;
+
+  if (biased_exponent <= 0) {
+    // Subnormal values are a multiple of the smallest subnormal value, the significand carrying into the exponent field
+    // if it is rounded up to the smallest normal value
+    return sign | static_cast<unsigned long long>(std::nearbyint(std::ldexp(value, bias - 1 + significand_bits)));
+  }
+
+  auto significand = static_cast<unsigned long long>(std::nearbyint(std::ldexp(fraction, significand_bits + 1)));
+  if (significand >> (significand_bits + 1)) {
+    significand >>= 1;
+    biased_exponent++;
+  }
+  if (static_cast<unsigned long long>(biased_exponent) >= max_exponent)
+    return sign | max_exponent << significand_bits;
+
+  return sign | static_cast<unsigned long long>(biased_exponent) << significand_bits |
+         (significand & ((1ull << significand_bits) - 1));
+}
+
+//! \brief Inverse of `encode_binary`
+template<std::size_t Size>
+double decode_binary(unsigned long long bits) {
+  constexpr int exponent_bits = binary_format<Size>::exponent_bits;
+  constexpr int significand_bits = binary_format<Size>::significand_bits;
+  constexpr unsigned long long max_exponent = (1ull << exponent_bits) - 1;
+  constexpr int bias = (1 << (exponent_bits - 1)) - 1;
+
+  auto significand = bits & ((1ull << significand_bits) - 1);
+  auto biased_exponent = bits >> significand_bits & max_exponent;
+  double magnitude;
+
+  if (biased_exponent == max_exponent)
+    magnitude = significand ? std::numeric_limits<double>::quiet_NaN() : std::numeric_limits<double>::infinity();
+  else if (biased_exponent == 0)
+    magnitude = std::ldexp(static_cast<double>(significand), 1 - bias - significand_bits);
+  else
+    magnitude = std::ldexp(static_cast<double>(significand | 1ull << significand_bits),
+                           static_cast<int>(biased_exponent) - bias - significand_bits);
+
+  return bits >> (Size * 8 - 1) & 1 ? -magnitude : magnitude;
+}
+
+//! \brief Indicates whether values of type `T` are represented on the platform in the IEEE 754 binary interchange
+//! format of the same size
+template<typename T>
+struct is_ieee_binary
+    : std::integral_constant<bool, std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8)> {};
+
+//! \name
+//! \brief Get the IEEE 754 binary representation of a floating-point value
+//!
+//! On platforms representing `T` in the IEEE 754 format, the representation is copied as is.
+//! @{
+
+template<typename T, require<is_ieee_binary<T>::value> = 0>
+typename word<sizeof(T)>::type to_binary(T value) {
+  typename word<sizeof(T)>::type retval;
+  std::memcpy(&retval, &value, sizeof(T));
+
+  return retval;
+}
+template<typename T, require<!is_ieee_binary<T>::value> = 0>
+typename word<sizeof(T)>::type to_binary(T value) {
+  return static_cast<typename word<sizeof(T)>::type>(encode_binary<sizeof(T)>(value));
+}
+
+//! @}
+
+//! \name
+//! \brief Inverse of `to_binary`
+//! @{
+
+template<typename T, require<is_ieee_binary<T>::value> = 0>
+T from_binary(typename word<sizeof(T)>::type bits) {
+  T retval;
+  std::memcpy(&retval, &bits, sizeof(T));
+
+  return retval;
+}
+template<typename T, require<!is_ieee_binary<T>::value> = 0>
+T from_binary(typename word<sizeof(T)>::type bits) {
+  return static_cast<T>(decode_binary<sizeof(T)>(bits));
+}
+
+//! @}
+
+} // namespace detail
+} // namespace upd
@@ -0,0 +1,343 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "../format.hpp"
+#include "../type.hpp"
+#include "../upd.hpp"
+#include "endianess.hpp"
+#include "type_traits/require.hpp"
+
+#if !defined(UPD_NO_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define UPD_HAS_SSE2
+#endif
+#if defined(__SSSE3__)
+#define UPD_HAS_SSSE3
+#endif
+#if defined(__AVX2__)
+#define UPD_HAS_AVX2
+#endif
+#endif // !defined(UPD_NO_SIMD)
+
+#if defined(UPD_HAS_SSE2)
+#include <immintrin.h>
+#endif // defined(UPD_HAS_SSE2)
+
+namespace upd {
+namespace detail {
+
+//! \brief Lane-wise operations on integers of `Size` bytes held in a plain unsigned integer
+template<std::size_t Size>
+struct scalar_lanes {
+  using type = typename word<Size>::type;
+
+  static type set1(type x) { return x; }
+  static type add(type x, type y) { return type(x + y); }
+  static type sub(type x, type y) { return type(x - y); }
+  static type bit_and(type x, type y) { return type(x & y); }
+  static type bit_or(type x, type y) { return type(x | y); }
+  static type bit_xor(type x, type y) { return type(x ^ y); }
+  static type sign_mask(type x) { return type(0 - (x >> (8 * Size - 1))); }
+  static type swap_bytes(type x) { return byteswap(x); }
+};
+
+#if defined(UPD_HAS_SSE2)
+
+//! \brief Lane-wise operations on integers of `Size` bytes held in a SSE register
+template<std::size_t Size>
+struct sse_lanes;
+
+//! \brief Operations common to every lane width
+struct sse_lanes_base {
+  using type = __m128i;
+
+  static type bit_and(type x, type y) { return _mm_and_si128(x, y); }
+  static type bit_or(type x, type y) { return _mm_or_si128(x, y); }
+  static type bit_xor(type x, type y) { return _mm_xor_si128(x, y); }
+};
+
+template<>
+struct sse_lanes<2> : sse_lanes_base {
+  static type set1(std::uint16_t x) { return _mm_set1_epi16(static_cast<short>(x)); }
+  static type add(type x, type y) { return _mm_add_epi16(x, y); }
+  static type sub(type x, type y) { return _mm_sub_epi16(x, y); }
+  static type sign_mask(type x) { return _mm_srai_epi16(x, 15); }
+  static type swap_bytes(type x) { return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8)); }
+};
+
+template<>
+struct sse_lanes<4> : sse_lanes_base {
+  static type set1(std::uint32_t x) { return _mm_set1_epi32(static_cast<int>(x)); }
+  static type add(type x, type y) { return _mm_add_epi32(x, y); }
+  static type sub(type x, type y) { return _mm_sub_epi32(x, y); }
+  static type sign_mask(type x) { return _mm_srai_epi32(x, 31); }
+  static type swap_bytes(type x) {
+#if defined(UPD_HAS_SSSE3)
+    return _mm_shuffle_epi8(x, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+#else  // defined(UPD_HAS_SSSE3)
+    x = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+    return sse_lanes<2>::swap_bytes(x);
+#endif // defined(UPD_HAS_SSSE3)
+  }
+};
+
+template<>
+struct sse_lanes<8> : sse_lanes_base {
+  static type set1(std::uint64_t x) { return _mm_set1_epi64x(static_cast<long long>(x)); }
+  static type add(type x, type y) { return _mm_add_epi64(x, y); }
+  static type sub(type x, type y) { return _mm_sub_epi64(x, y); }
+  static type sign_mask(type x) { return _mm_shuffle_epi32(_mm_srai_epi32(x, 31), _MM_SHUFFLE(3, 3, 1, 1)); }
+  static type swap_bytes(type x) {
+#if defined(UPD_HAS_SSSE3)
+    return _mm_shuffle_epi8(x, _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+#else  // defined(UPD_HAS_SSSE3)
+    x = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3));
+    return sse_lanes<2>::swap_bytes(x);
+#endif // defined(UPD_HAS_SSSE3)
+  }
+};
+
+#endif // defined(UPD_HAS_SSE2)
+
+#if defined(UPD_HAS_AVX2)
+
+//! \brief Lane-wise operations on integers of `Size` bytes held in an AVX register
+template<std::size_t Size>
+struct avx_lanes;
+
+//! \brief Operations common to every lane width
+struct avx_lanes_base {
+  using type = __m256i;
+
+  static type bit_and(type x, type y) { return _mm256_and_si256(x, y); }
+  static type bit_or(type x, type y) { return _mm256_or_si256(x, y); }
+  static type bit_xor(type x, type y) { return _mm256_xor_si256(x, y); }
+};
+
+template<>
+struct avx_lanes<2> : avx_lanes_base {
+  static type set1(std::uint16_t x) { return _mm256_set1_epi16(static_cast<short>(x)); }
+  static type add(type x, type y) { return _mm256_add_epi16(x, y); }
+  static type sub(type x, type y) { return _mm256_sub_epi16(x, y); }
+  static type sign_mask(type x) { return _mm256_srai_epi16(x, 15); }
+  static type swap_bytes(type x) {
+    return _mm256_shuffle_epi8(x,
+                               _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                                1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+  }
+};
+
+template<>
+struct avx_lanes<4> : avx_lanes_base {
+  static type set1(std::uint32_t x) { return _mm256_set1_epi32(static_cast<int>(x)); }
+  static type add(type x, type y) { return _mm256_add_epi32(x, y); }
+  static type sub(type x, type y) { return _mm256_sub_epi32(x, y); }
+  static type sign_mask(type x) { return _mm256_srai_epi32(x, 31); }
+  static type swap_bytes(type x) {
+    return _mm256_shuffle_epi8(x,
+                               _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                                3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+  }
+};
+
+template<>
+struct avx_lanes<8> : avx_lanes_base {
+  static type set1(std::uint64_t x) { return _mm256_set1_epi64x(static_cast<long long>(x)); }
+  static type add(type x, type y) { return _mm256_add_epi64(x, y); }
+  static type sub(type x, type y) { return _mm256_sub_epi64(x, y); }
+  static type sign_mask(type x) { return _mm256_cmpgt_epi64(_mm256_setzero_si256(), x); }
+  static type swap_bytes(type x) {
+    return _mm256_shuffle_epi8(x,
+                               _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                                7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+  }
+};
+
+#endif // defined(UPD_HAS_AVX2)
+
+//! \brief Sign bit of an integer of `Size` bytes
+template<std::size_t Size>
+using sign_bit = std::integral_constant<typename word<Size>::type, typename word<Size>::type(1) << (8 * Size - 1)>;
+
+//! \name
+//! \brief Lane-wise conversions from the provided signed representation to two's complement
+//!
+//! `Lanes` provides the lane-wise operations. Every conversion is branchless, so that it applies the same way to a
+//! single integer or to a SIMD register.
+//! @{
+
+template<signed_mode Signed_Mode,
+         std::size_t Size,
+         typename Lanes,
+         require<Signed_Mode == signed_mode::SIGNED_MAGNITUDE> = 0>
+typename Lanes::type decode_signed(typename Lanes::type x) {
+  auto sign = Lanes::sign_mask(x);
+  auto magnitude = Lanes::bit_and(x, Lanes::set1(typename word<Size>::type(~sign_bit<Size>::value)));
+  return Lanes::sub(Lanes::bit_xor(magnitude, sign), sign);
+}
+template<signed_mode Signed_Mode,
+         std::size_t Size,
+         typename Lanes,
+         require<Signed_Mode == signed_mode::ONES_COMPLEMENT> = 0>
+typename Lanes::type decode_signed(typename Lanes::type x) {
+  return Lanes::sub(x, Lanes::sign_mask(x));
+}
+template<signed_mode Signed_Mode,
+         std::size_t Size,
+         typename Lanes,
+         require<Signed_Mode == signed_mode::TWOS_COMPLEMENT> = 0>
+typename Lanes::type decode_signed(typename Lanes::type x) {
+  return x;
+}
+template<signed_mode Signed_Mode,
+         std::size_t Size,
+         typename Lanes,
+         require<Signed_Mode == signed_mode::OFFSET_BINARY> = 0>
+typename Lanes::type decode_signed(typename Lanes::type x) {
+  return Lanes::bit_xor(x, Lanes::set1(sign_bit<Size>::value));
+}
+
+//! @}
+
+//! \name
+//! \brief Lane-wise conversions from two's complement to the provided signed representation
+//! @{
+
+template<signed_mode Signed_Mode,
+         std::size_t Size,
+         typename Lanes,
+         require<Signed_Mode == signed_mode::SIGNED_MAGNITUDE> = 0>
+typename Lanes::type encode_signed(typename Lanes::type x) {
+  auto sign = Lanes::sign_mask(x);
+  auto magnitude = Lanes::sub(Lanes::bit_xor(x, sign), sign);
+  return Lanes::bit_or(magnitude, Lanes::bit_and(sign, Lanes::set1(sign_bit<Size>::value)));
+}
+template<signed_mode Signed_Mode,
+         std::size_t Size,
+         typename Lanes,
+         require<Signed_Mode == signed_mode::ONES_COMPLEMENT> = 0>
+typename Lanes::type encode_signed(typename Lanes::type x) {
+  return Lanes::add(x, Lanes::sign_mask(x));
+}
+template<signed_mode Signed_Mode,
+         std::size_t Size,
+         typename Lanes,
+         require<Signed_Mode == signed_mode::TWOS_COMPLEMENT> = 0>
+typename Lanes::type encode_signed(typename Lanes::type x) {
+  return x;
+}
+template<signed_mode Signed_Mode,
+         std::size_t Size,
+         typename Lanes,
+         require<Signed_Mode == signed_mode::OFFSET_BINARY> = 0>
+typename Lanes::type encode_signed(typename Lanes::type x) {
+  return Lanes::bit_xor(x, Lanes::set1(sign_bit<Size>::value));
+}
+
+//! @}
+
+//! \brief Reverse the byte order of every lane if `Swap` is `true`
+template<bool Swap, typename Lanes, require<Swap> = 0>
+typename Lanes::type swap_bytes_if(typename Lanes::type x) {
+  return Lanes::swap_bytes(x);
+}
+template<bool Swap, typename Lanes, require<!Swap> = 0>
+typename Lanes::type swap_bytes_if(typename Lanes::type x) {
+  return x;
+}
+
+//! \brief Conversion of serialized integers of `Size` bytes into native integers
+template<std::size_t Size, bool Swap, signed_mode Signed_Mode>
+struct decode_lanes {
+  constexpr static bool is_identity = !Swap && Signed_Mode == signed_mode::TWOS_COMPLEMENT;
+
+  template<typename Lanes>
+  static typename Lanes::type apply(typename Lanes::type x) {
+    return decode_signed<Signed_Mode, Size, Lanes>(swap_bytes_if<Swap, Lanes>(x));
+  }
+};
+
+//! \brief Conversion of native integers of `Size` bytes into serialized integers
+template<std::size_t Size, bool Swap, signed_mode Signed_Mode>
+struct encode_lanes {
+  constexpr static bool is_identity = !Swap && Signed_Mode == signed_mode::TWOS_COMPLEMENT;
+
+  template<typename Lanes>
+  static typename Lanes::type apply(typename Lanes::type x) {
+    return swap_bytes_if<Swap, Lanes>(encode_signed<Signed_Mode, Size, Lanes>(x));
+  }
+};
+
+//! \brief Apply `Op` in place on the `count` integers of `Size` bytes stored in `data`
+//!
+//! The widest available SIMD registers are used first, the remaining integers being converted one by one.
+template<std::size_t Size, typename Op, require<Op::is_identity> = 0>
+void transform_lanes(byte_t *, std::size_t) {}
+template<std::size_t Size, typename Op, require<!Op::is_identity> = 0>
+void transform_lanes(byte_t *data, std::size_t count) {
+  const auto length = count * Size;
+  std::size_t i = 0;
+
+#if defined(UPD_HAS_AVX2)
+  for (; i + sizeof(__m256i) <= length; i += sizeof(__m256i)) {
+    auto *ptr = reinterpret_cast<__m256i *>(data + i);
+    _mm256_storeu_si256(ptr, Op::template apply<avx_lanes<Size>>(_mm256_loadu_si256(ptr)));
+  }
+#endif // defined(UPD_HAS_AVX2)
+
+#if defined(UPD_HAS_SSE2)
+  for (; i + sizeof(__m128i) <= length; i += sizeof(__m128i)) {
+    auto *ptr = reinterpret_cast<__m128i *>(data + i);
+    _mm_storeu_si128(ptr, Op::template apply<sse_lanes<Size>>(_mm_loadu_si128(ptr)));
+  }
+#endif // defined(UPD_HAS_SSE2)
+
+  for (; i < length; i += Size) {
+    typename word<Size>::type x;
+    std::memcpy(&x, data + i, Size);
+    x = Op::template apply<scalar_lanes<Size>>(x);
+    std::memcpy(data + i, &x, Size);
+  }
+}
+
+//! \brief Indicates whether arrays of `T` can be converted with `read_integer_array` and `write_integer_array`
+//!
+//! The conversions rely on the native representation of integers, therefore the platform endianess must be known and
+//! the platform signed representation must be two's complement.
+template<typename T>
+struct is_bulk_convertible
+    : std::integral_constant<bool,
+                             std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                                 (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8) &&
+                                 (platform_info.endianess == endianess::LITTLE ||
+                                  platform_info.endianess == endianess::BIG) &&
+                                 platform_info.signed_mode == signed_mode::TWOS_COMPLEMENT> {};
+
+//! \brief Unserialize `count` integers from `sequence` into `output`
+template<typename T, endianess Endianess, signed_mode Signed_Mode>
+void read_integer_array(const byte_t *sequence, T *output, std::size_t count) {
+  constexpr auto wire_signed_mode = std::is_signed<T>::value ? Signed_Mode : signed_mode::TWOS_COMPLEMENT;
+  using op_t = decode_lanes<sizeof(T), platform_info.endianess != Endianess, wire_signed_mode>;
+
+  std::memcpy(output, sequence, count * sizeof(T));
+  transform_lanes<sizeof(T), op_t>(reinterpret_cast<byte_t *>(output), count);
+}
+
+//! \brief Serialize `count` integers from `input` into `sequence`
+template<endianess Endianess, signed_mode Signed_Mode, typename T>
+void write_integer_array(const T *input, byte_t *sequence, std::size_t count) {
+  constexpr auto wire_signed_mode = std::is_signed<T>::value ? Signed_Mode : signed_mode::TWOS_COMPLEMENT;
+  using op_t = encode_lanes<sizeof(T), platform_info.endianess != Endianess, wire_signed_mode>;
+
+  std::memcpy(sequence, input, count * sizeof(T));
+  transform_lanes<sizeof(T), op_t>(sequence, count);
+}
+
+} // namespace detail
+} // namespace upd
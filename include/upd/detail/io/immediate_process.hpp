@@ -15,29 +15,61 @@ namespace detail {
 //! \brief CRTP base class used to define class whose instances process input and yield output immediately
 //! \details
 //!   Immediate process can be invoked on a byte input and a byte output.
-//!   Derived classes must be invocable on an input functor an output functor.
+//!   Derived classes must be invocable on an input functor an output functor. When both the input and the output are
+//!   iterators to contiguous storage, they are forwarded to `process_contiguous`, which derived classes may hide with a
+//!   bulk implementation taking plain pointers.
 template<typename D, typename R>
 class immediate_process {
   D &derived() { return reinterpret_cast<D &>(*this); }
   const D &derived() const { return reinterpret_cast<const D &>(*this); }
 
+  //! \brief Indicates whether `Input` and `Output` are iterators to contiguous storage allowing bulk reads and writes
+  template<typename Input, typename Output>
+  using are_contiguous = std::integral_constant<
+      bool,
+      is_input_byte_iterator<decay_t<Input>>::value && is_contiguous_byte_iterator<decay_t<Input>>::value &&
+          is_output_byte_iterator<decay_t<Output>>::value && is_contiguous_byte_iterator<decay_t<Output>>::value>;
+
 public:
   template<typename Input,
            typename Output,
-           UPD_REQUIRE(is_input_byte_iterator<decay_t<Input>>::value ||
-                       is_output_byte_iterator<decay_t<Output>>::value)>
+           UPD_REQUIRE((is_input_byte_iterator<decay_t<Input>>::value ||
+                        is_output_byte_iterator<decay_t<Output>>::value) &&
+                       !are_contiguous<Input, Output>::value)>
   R operator()(Input &&input, Output &&output, no_derived_member_shadowing = 0) {
     return derived()(normalize(UPD_FWD(input), reader_tag_t{}), normalize(UPD_FWD(output), writer_tag_t{}));
   }
 
   template<typename Input,
            typename Output,
-           UPD_REQUIRE(is_input_byte_iterator<decay_t<Input>>::value ||
-                       is_output_byte_iterator<decay_t<Output>>::value)>
+           UPD_REQUIRE((is_input_byte_iterator<decay_t<Input>>::value ||
+                        is_output_byte_iterator<decay_t<Output>>::value) &&
+                       !are_contiguous<Input, Output>::value)>
   R operator()(Input &&input, Output &&output, no_derived_member_shadowing = 0) const {
     return derived()(normalize(UPD_FWD(input), reader_tag_t{}), normalize(UPD_FWD(output), writer_tag_t{}));
   }
 
+  template<typename Input, typename Output, UPD_REQUIRE(are_contiguous<Input, Output>::value)>
+  R operator()(Input input, Output output, no_derived_member_shadowing = 0) {
+    return derived().process_contiguous(address_of(input), address_of(output));
+  }
+
+  template<typename Input, typename Output, UPD_REQUIRE(are_contiguous<Input, Output>::value)>
+  R operator()(Input input, Output output, no_derived_member_shadowing = 0) const {
+    return derived().process_contiguous(address_of(input), address_of(output));
+  }
+
+  //! \brief Process a byte sequence from contiguous storage into contiguous storage (byte-wise unless hidden by the
+  //! derived class)
+  R process_contiguous(const byte_t *input, byte_t *output) {
+    return derived()(reader_iterator<const byte_t *>{input}, writer_iterator<byte_t *>{output});
+  }
+
+  //! \copydoc process_contiguous
+  R process_contiguous(const byte_t *input, byte_t *output) const {
+    return derived()(reader_iterator<const byte_t *>{input}, writer_iterator<byte_t *>{output});
+  }
+
 private:
   struct reader_tag_t {};
   struct writer_tag_t {};
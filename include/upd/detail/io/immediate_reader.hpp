@@ -2,7 +2,9 @@
 
 #pragma once
 
+#include "../../type.hpp"
 #include "../../upd.hpp"
+#include "../type_traits/iterator_category.hpp"
 #include "../type_traits/require.hpp"
 
 namespace upd {
@@ -11,7 +13,8 @@ namespace detail {
 //! \brief CRTP base class used to define immediate reading members functions
 //!
 //! Immediate readers are able to read a byte sequence completely. Derived classes must define a `read_from` invocable
-//! on an input functor.
+//! on an input functor. Iterators to contiguous storage are forwarded to `read_from_contiguous`, which derived classes
+//! may hide with a bulk implementation taking a plain pointer.
 template<typename D, typename R>
 class immediate_reader {
   D &derived() { return reinterpret_cast<D &>(*this); }
@@ -28,16 +31,44 @@ public:
     return derived().read_from(UPD_FWD(src));
   }
 
-  template<typename It, UPD_REQUIREMENT(input_byte_iterator, It)>
+  template<typename It,
+           UPD_REQUIREMENT(input_byte_iterator, It),
+           UPD_REQUIRE(!is_contiguous_byte_iterator<It>::value)>
   R read_from(It it) {
     return derived().read_from([&]() { return *it++; });
   }
 
-  template<typename It, UPD_REQUIREMENT(input_byte_iterator, It)>
+  template<typename It,
+           UPD_REQUIREMENT(input_byte_iterator, It),
+           UPD_REQUIRE(!is_contiguous_byte_iterator<It>::value)>
   R read_from(It it) const {
     return derived().read_from([&]() { return *it++; });
   }
 
+  template<typename It,
+           UPD_REQUIREMENT(input_byte_iterator, It),
+           UPD_REQUIRE(is_contiguous_byte_iterator<It>::value)>
+  R read_from(It it) {
+    return derived().read_from_contiguous(address_of(it));
+  }
+
+  template<typename It,
+           UPD_REQUIREMENT(input_byte_iterator, It),
+           UPD_REQUIRE(is_contiguous_byte_iterator<It>::value)>
+  R read_from(It it) const {
+    return derived().read_from_contiguous(address_of(it));
+  }
+
+  //! \brief Read a byte sequence from contiguous storage (byte-wise unless hidden by the derived class)
+  R read_from_contiguous(const byte_t *src) {
+    return derived().read_from([&]() { return *src++; });
+  }
+
+  //! \copydoc read_from_contiguous
+  R read_from_contiguous(const byte_t *src) const {
+    return derived().read_from([&]() { return *src++; });
+  }
+
   template<typename It, UPD_REQUIREMENT(input_byte_iterator, It)>
   R operator<<(It src) {
     return read_from(src);
@@ -4,6 +4,7 @@
 
 #include "../../type.hpp"
 #include "../../upd.hpp"
+#include "../type_traits/iterator_category.hpp"
 #include "../type_traits/require.hpp"
 
 namespace upd {
@@ -12,7 +13,9 @@ namespace detail {
 //! \brief CRTP base class used to define immediate writing members functions
 //! \details
 //!   Immediate writers are able to write a byte sequence completely.
-//!   Derived classes must define a `write_to` invocable on an input functor.
+//!   Derived classes must define a `write_to` invocable on an input functor. Iterators to contiguous storage are
+//!   forwarded to `write_to_contiguous`, which derived classes may hide with a bulk implementation taking a plain
+//!   pointer.
 template<typename D>
 class immediate_writer {
   D &derived() { return reinterpret_cast<D &>(*this); }
@@ -29,16 +32,44 @@ public:
     derived().write_to(UPD_FWD(dest));
   }
 
-  template<typename It, UPD_REQUIREMENT(output_byte_iterator, It)>
+  template<typename It,
+           UPD_REQUIREMENT(output_byte_iterator, It),
+           UPD_REQUIRE(!is_contiguous_byte_iterator<It>::value)>
   void write_to(It it) {
     derived().write_to([&](byte_t byte) { *it++ = byte; });
   }
 
-  template<typename It, UPD_REQUIREMENT(output_byte_iterator, It)>
+  template<typename It,
+           UPD_REQUIREMENT(output_byte_iterator, It),
+           UPD_REQUIRE(!is_contiguous_byte_iterator<It>::value)>
   void write_to(It it) const {
     derived().write_to([&](byte_t byte) { *it++ = byte; });
   }
 
+  template<typename It,
+           UPD_REQUIREMENT(output_byte_iterator, It),
+           UPD_REQUIRE(is_contiguous_byte_iterator<It>::value)>
+  void write_to(It it) {
+    derived().write_to_contiguous(address_of(it));
+  }
+
+  template<typename It,
+           UPD_REQUIREMENT(output_byte_iterator, It),
+           UPD_REQUIRE(is_contiguous_byte_iterator<It>::value)>
+  void write_to(It it) const {
+    derived().write_to_contiguous(address_of(it));
+  }
+
+  //! \brief Write a byte sequence into contiguous storage (byte-wise unless hidden by the derived class)
+  void write_to_contiguous(byte_t *dest) {
+    derived().write_to([&](byte_t byte) { *dest++ = byte; });
+  }
+
+  //! \copydoc write_to_contiguous
+  void write_to_contiguous(byte_t *dest) const {
+    derived().write_to([&](byte_t byte) { *dest++ = byte; });
+  }
+
   template<typename It, UPD_REQUIREMENT(output_byte_iterator, It)>
   void operator>>(It src) {
     write_to(src);
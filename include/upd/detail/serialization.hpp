@@ -2,13 +2,22 @@
 
 #include <array>
 #include <cstddef>
+#include <cstring>
 #include <iterator> // IWYU pragma: keep
 #include <type_traits>
 
+#include "../bounded_vector.hpp"
+#include "../fixed.hpp"
 #include "../format.hpp"
+#include "../half.hpp"
+#include "../packed.hpp"
+#include "../ranged.hpp"
 #include "../type.hpp"
 #include "../upd.hpp"
+#include "../varint.hpp"
 #include "endianess.hpp"
+#include "ieee754.hpp"
+#include "integer_array.hpp"
 #include "signed_representation.hpp"
 #include "type_traits/detector.hpp"
 #include "type_traits/require.hpp"
@@ -46,6 +55,25 @@ using array_t = typename array_t_impl<T>::type;
 
 //! @}
 
+//! \name
+//! \brief Size in bytes of the serialized representation of a value of type `T` laid out without an extension
+//!
+//! It is the size of `T`, except for the types serialized as an integer representation of their values, and arrays of
+//! such types, which are laid out with the size of the representation.
+//! @{
+
+template<typename T, typename = void>
+struct serialized_width : std::integral_constant<std::size_t, sizeof(T)> {};
+template<typename T>
+struct serialized_width<T, typename std::enable_if<is_integer_backed<T>::value>::type>
+    : std::integral_constant<std::size_t, sizeof(typename integer_backing<T>::representation_t)> {};
+template<typename T, std::size_t N>
+struct serialized_width<T[N]> : std::integral_constant<std::size_t, N * serialized_width<T>::value> {};
+template<typename T, std::size_t N>
+struct serialized_width<std::array<T, N>> : serialized_width<T[N]> {};
+
+//! @}
+
 //! \brief Interpret a part of a byte sequence as a value of the given type
 //! \tparam T Requested type
 //! \tparam Endianess Endianess of the value representation in the byte sequence
@@ -66,7 +94,33 @@ T read_as(const byte_t *sequence) {
 
   return detail::from_signed_mode<T, Signed_Mode>(tmp);
 }
-template<typename T, endianess Endianess, signed_mode Signed_Mode, detail::require_array<T> = 0>
+template<typename T, endianess Endianess, signed_mode, detail::require_floating_point<T> = 0>
+T read_as(const byte_t *sequence) {
+  using word_t = typename detail::word<sizeof(T)>::type;
+  return detail::from_binary<T>(detail::from_endianess<word_t, Endianess>(sequence, sizeof(T)));
+}
+template<typename T, endianess Endianess, signed_mode Signed_Mode, detail::require_is_integer_backed<T> = 0>
+T read_as(const byte_t *sequence) {
+  using backing_t = detail::integer_backing<T>;
+  return backing_t::decode(read_as<typename backing_t::representation_t, Endianess, Signed_Mode>(sequence));
+}
+template<typename T,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         detail::require_array<T> = 0,
+         detail::require<detail::is_bulk_convertible<typename detail::array_t<T>::value_type>::value> = 0>
+detail::array_t<T> read_as(const byte_t *sequence) {
+  detail::array_t<T> retval;
+  detail::read_integer_array<typename detail::array_t<T>::value_type, Endianess, Signed_Mode>(
+      sequence, retval.data(), retval.size());
+
+  return retval;
+}
+template<typename T,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         detail::require_array<T> = 0,
+         detail::require<!detail::is_bulk_convertible<typename detail::array_t<T>::value_type>::value> = 0>
 detail::array_t<T> read_as(const byte_t *sequence) {
   detail::array_t<T> retval;
 
@@ -74,7 +128,7 @@ detail::array_t<T> read_as(const byte_t *sequence) {
   constexpr auto size = retval.size();
 
   for (std::size_t i = 0; i < size; i++)
-    retval[i] = read_as<element_t, Endianess, Signed_Mode>(sequence + i * sizeof(element_t));
+    retval[i] = read_as<element_t, Endianess, Signed_Mode>(sequence + i * detail::serialized_width<element_t>::value);
 
   return retval;
 }
@@ -84,13 +138,94 @@ T read_as(const byte_t *sequence) {
       sequence, detail::examine_invocable<decltype(upd_extension<T>::unserialize)>{});
   return view.invoke(upd_extension<T>::unserialize);
 }
-template<typename T, endianess Endianess, signed_mode Signed_Mode, typename It, detail::require_not_pointer<It> = 0>
+
+template<typename T, endianess Endianess, signed_mode Signed_Mode, detail::require_is_array_view<T> = 0>
+T read_as(const byte_t *sequence) {
+  static_assert(T::storage_endianess == Endianess && T::storage_signed_mode == Signed_Mode,
+                "Array views must have the serialization parameters of the byte sequence they are bound to");
+  return T{sequence};
+}
+template<typename T, endianess, signed_mode, detail::require_is_varint<T> = 0>
+T read_as(const byte_t *sequence) {
+  return detail::read_varint<typename T::value_type>(sequence);
+}
+template<typename T, endianess Endianess, signed_mode Signed_Mode, detail::require_is_bounded_vector<T> = 0>
+T read_as(const byte_t *sequence) {
+  using element_t = typename T::value_type;
+  using size_type = typename T::size_type;
+  auto elements = sequence + detail::varint_length<size_type>(sequence, varint<size_type>::max_size);
+
+  T retval;
+  retval.resize(detail::read_bounded_size<T>(sequence));
+  for (std::size_t i = 0; i < retval.size(); i++)
+    retval[i] = read_as<element_t, Endianess, Signed_Mode>(elements + i * sizeof(element_t));
+
+  return retval;
+}
+template<typename T, endianess, signed_mode, detail::require_is_packed<T> = 0>
+T read_as(const byte_t *sequence) {
+  T retval;
+  std::memcpy(retval.data(), sequence, T::size);
+
+  return retval;
+}
+template<typename T,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename It,
+         detail::require_not_pointer<It> = 0,
+         detail::require_not_array_view<T> = 0,
+         detail::require_fixed_length<T> = 0,
+         detail::require_not_integer_backed<T> = 0>
 decltype(read_as<T, Endianess, Signed_Mode>(std::declval<byte_t *>())) read_as(It it) {
-  byte_t buf[sizeof(T)];
+  byte_t buf[detail::serialized_width<T>::value];
   for (byte_t &byte : buf)
     byte = *it++;
   return read_as<T, Endianess, Signed_Mode>(buf);
 }
+template<typename T,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename It,
+         detail::require_not_pointer<It> = 0,
+         detail::require_is_integer_backed<T> = 0>
+T read_as(It it) {
+  using backing_t = detail::integer_backing<T>;
+  return backing_t::decode(read_as<typename backing_t::representation_t, Endianess, Signed_Mode>(it));
+}
+template<typename T,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename It,
+         detail::require_not_pointer<It> = 0,
+         detail::require_is_varint<T> = 0>
+T read_as(It it) {
+  byte_t buf[T::max_size];
+  std::size_t i = 0;
+  do
+    buf[i] = *it++;
+  while (buf[i++] & 0x80 && i < T::max_size);
+
+  return read_as<T, Endianess, Signed_Mode>(static_cast<const byte_t *>(buf));
+}
+template<typename T,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename It,
+         detail::require_not_pointer<It> = 0,
+         detail::require_is_bounded_vector<T> = 0>
+T read_as(It it) {
+  byte_t buf[detail::bounded_vector_storage_size<T>::value];
+  std::size_t loaded = 0;
+  do
+    buf[loaded] = *it++;
+  while (buf[loaded++] & 0x80 && loaded < varint<typename T::size_type>::max_size);
+
+  for (auto size = detail::bounded_vector_length<T>(buf, loaded); loaded < size;)
+    buf[loaded++] = *it++;
+
+  return read_as<T, Endianess, Signed_Mode>(static_cast<const byte_t *>(buf));
+}
 #endif
 
 //! \brief Interpret a part of a byte sequence as a value of the given type at the given offset
@@ -134,12 +269,33 @@ void write_as(const T &x, byte_t *sequence) {
 
   detail::to_endianess<Endianess>(sequence, tmp, sizeof(x));
 }
-template<endianess Endianess, signed_mode Signed_Mode, typename T, detail::require_array<T> = 0>
+template<endianess Endianess, signed_mode, typename T, detail::require_floating_point<T> = 0>
+void write_as(const T &x, byte_t *sequence) {
+  detail::to_endianess<Endianess>(sequence, detail::to_binary(x), sizeof(x));
+}
+template<endianess Endianess, signed_mode Signed_Mode, typename T, detail::require_is_integer_backed<T> = 0>
+void write_as(const T &x, byte_t *sequence) {
+  write_as<Endianess, Signed_Mode>(detail::integer_backing<T>::encode(x), sequence);
+}
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         detail::require_array<T> = 0,
+         detail::require<detail::is_bulk_convertible<typename detail::array_t<T>::value_type>::value> = 0>
 void write_as(const T &array, byte_t *sequence) {
-  using element_t = decltype(array[0]);
+  constexpr auto array_size = sizeof(array) / sizeof(array[0]);
+  detail::write_integer_array<Endianess, Signed_Mode>(&array[0], sequence, array_size);
+}
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         detail::require_array<T> = 0,
+         detail::require<!detail::is_bulk_convertible<typename detail::array_t<T>::value_type>::value> = 0>
+void write_as(const T &array, byte_t *sequence) {
+  using element_t = typename detail::array_t<T>::value_type;
   constexpr auto array_size = sizeof(array) / sizeof(array[0]);
   for (std::size_t i = 0; i < array_size; i++)
-    write_as<Endianess, Signed_Mode>(array[i], sequence + i * sizeof(element_t));
+    write_as<Endianess, Signed_Mode>(array[i], sequence + i * detail::serialized_width<element_t>::value);
 }
 template<endianess Endianess, signed_mode Signed_Mode, typename T, detail::require_is_user_serializable<T> = 0>
 void write_as(const T &x, byte_t *sequence) {
@@ -147,14 +303,79 @@ void write_as(const T &x, byte_t *sequence) {
       sequence, detail::examine_invocable<decltype(upd_extension<T>::unserialize)>{});
   upd_extension<T>::serialize(x, view);
 }
-template<endianess Endianess, signed_mode Signed_Mode, typename T, typename It, detail::require_not_pointer<It> = 0>
+template<endianess Endianess, signed_mode Signed_Mode, typename T, detail::require_is_array_view<T> = 0>
+void write_as(const T &view, byte_t *sequence) {
+  using element_t = typename T::value_type;
+  for (std::size_t i = 0; i < view.size(); i++)
+    write_as<Endianess, Signed_Mode>(view[i], sequence + i * detail::serialized_width<element_t>::value);
+}
+template<endianess, signed_mode, typename T, detail::require_is_varint<T> = 0>
+void write_as(const T &x, byte_t *sequence) {
+  detail::write_varint(x.value(), sequence);
+}
+template<endianess Endianess, signed_mode Signed_Mode, typename T, detail::require_is_bounded_vector<T> = 0>
+void write_as(const T &x, byte_t *sequence) {
+  using element_t = typename T::value_type;
+  auto elements = sequence + detail::write_varint(static_cast<typename T::size_type>(x.size()), sequence);
+
+  for (std::size_t i = 0; i < x.size(); i++)
+    write_as<Endianess, Signed_Mode>(x[i], elements + i * sizeof(element_t));
+}
+template<endianess, signed_mode, typename T, detail::require_is_packed<T> = 0>
+void write_as(const T &x, byte_t *sequence) {
+  std::memcpy(sequence, x.data(), T::size);
+}
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         typename It,
+         detail::require_not_pointer<It> = 0,
+         detail::require_not_array_view<T> = 0,
+         detail::require_fixed_length<T> = 0,
+         detail::require_not_integer_backed<T> = 0>
 void write_as(const T &value, It it) {
-  byte_t buf[sizeof(T)];
+  byte_t buf[detail::serialized_width<T>::value];
 
   write_as<Endianess, Signed_Mode>(value, buf);
   for (const byte_t &byte : buf)
     *it++ = byte;
 }
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         typename It,
+         detail::require_not_pointer<It> = 0,
+         detail::require_is_integer_backed<T> = 0>
+void write_as(const T &value, It it) {
+  write_as<Endianess, Signed_Mode>(detail::integer_backing<T>::encode(value), it);
+}
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         typename It,
+         detail::require_not_pointer<It> = 0,
+         detail::require_is_varint<T> = 0>
+void write_as(const T &value, It it) {
+  byte_t buf[T::max_size];
+
+  auto size = detail::write_varint(value.value(), buf);
+  for (std::size_t i = 0; i < size; i++)
+    *it++ = buf[i];
+}
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         typename It,
+         detail::require_not_pointer<It> = 0,
+         detail::require_is_bounded_vector<T> = 0>
+void write_as(const T &value, It it) {
+  byte_t buf[detail::bounded_vector_storage_size<T>::value];
+
+  write_as<Endianess, Signed_Mode>(value, buf);
+  auto size = detail::bounded_vector_length<T>(buf, sizeof buf);
+  for (std::size_t i = 0; i < size; i++)
+    *it++ = buf[i];
+}
 #endif
 
 //! \brief Serialize a value into a byte sequence at the given offset
@@ -193,5 +414,35 @@ struct is_serializable : decltype(is_serializable_impl<T>(0)) {};
 template<typename T, typename U = int>
 using require_is_serializable = require<is_serializable<T>::value, U>;
 
+#if __cplusplus >= 201703L
+//! \name
+//! \brief (C++17) Serialize a value into a byte sequence in a constant expression
+//!
+//! Only the platform-agnostic implementations are used, so integers and arrays of integers can be serialized at compile
+//! time.
+//!
+//! \return the end of the written bytes
+//! @{
+
+template<endianess Endianess, signed_mode, typename T, detail::require_unsigned_integer<T> = 0>
+constexpr byte_t *constexpr_write_as(const T &x, byte_t *sequence) {
+  to_endianess_impl<Endianess>(sequence, x, sizeof(x));
+  return sequence + sizeof(x);
+}
+template<endianess Endianess, signed_mode Signed_Mode, typename T, detail::require_signed_integer<T> = 0>
+constexpr byte_t *constexpr_write_as(const T &x, byte_t *sequence) {
+  to_endianess_impl<Endianess>(sequence, to_signed_mode_impl<Signed_Mode>(x), sizeof(x));
+  return sequence + sizeof(x);
+}
+template<endianess Endianess, signed_mode Signed_Mode, typename T, detail::require_array<T> = 0>
+constexpr byte_t *constexpr_write_as(const T &array, byte_t *sequence) {
+  for (const auto &value : array)
+    sequence = constexpr_write_as<Endianess, Signed_Mode>(value, sequence);
+  return sequence;
+}
+
+//! @}
+#endif // __cplusplus >= 201703L
+
 } // namespace detail
 } // namespace upd
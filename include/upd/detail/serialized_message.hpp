@@ -2,21 +2,52 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
 #include "../format.hpp"
 #include "../tuple.hpp"
+#include "../type.hpp"
 
 #include "io/immediate_writer.hpp"
+#include "type_traits/is_array.hpp"
 #include "type_traits/require.hpp"
+#include "wire_format.hpp"
 
 namespace upd {
 namespace detail {
 
+//! \name
+//! \brief Serialize a value and output it through a byte putter
+//!
+//! Arrays are serialized element by element, so that only a single element is stored at a time. Only the wire
+//! representation of variable-length values is output.
+//! @{
+
+template<endianess Endianess, signed_mode Signed_Mode, typename T, typename Dest_F, require_not_array<T> = 0>
+void write_value(const T &value, Dest_F &insert_byte) {
+  tuple<Endianess, Signed_Mode, T> storage{value};
+  wire_format<decltype(storage)>::emit(storage.begin(), insert_byte);
+}
+template<endianess Endianess, signed_mode Signed_Mode, typename T, typename Dest_F, require_array<T> = 0>
+void write_value(const T &values, Dest_F &insert_byte) {
+  for (const auto &value : values)
+    write_value<Endianess, Signed_Mode>(value, insert_byte);
+}
+
+//! @}
+
 //! \brief Simple wrapper around 'tuple' whose content can be forwarded to a functor as a byte sequence
 //! \details
 //!   The content can be forwarded with the 'operator>>' function member. 'detail::serialized_message' object
-//!   cannot be copied from to avoid unintentional copy.
+//!   cannot be copied from to avoid unintentional copy. Only the wire representation of the content is forwarded, so
+//!   messages holding variable-length values may be shorter than their content.
 template<endianess Endianess, signed_mode Signed_Mode, typename... Ts>
 struct serialized_message : detail::immediate_writer<serialized_message<Endianess, Signed_Mode, Ts...>> {
+  //! \brief Type of the payload storage
+  using content_t = tuple<Endianess, Signed_Mode, Ts...>;
+
   //! \brief Store the payload
   serialized_message(const Ts &...values) : content{values...} {}
 
@@ -31,11 +62,59 @@ struct serialized_message : detail::immediate_writer<serialized_message<Endianes
   //! \brief Completely output the payload represented by the key
   template<typename Dest_F, UPD_REQUIREMENT(output_invocable, Dest_F)>
   void write_to(Dest_F &&insert_byte) const {
-    for (auto byte : content)
+    wire_format<content_t>::emit(content.begin(), insert_byte);
+  }
+
+  //! \brief Copy the payload as a whole into contiguous storage
+  void write_to_contiguous(byte_t *dest) const { write_to_contiguous(dest, has_variable_length<content_t>{}); }
+
+  //! \brief Length in bytes of the payload output by `write_to()`
+  std::size_t size() const {
+    return has_variable_length<content_t>::value ? wire_format<content_t>::size(content.begin()) : content.size;
+  }
+
+  content_t content;
+
+private:
+  void write_to_contiguous(byte_t *dest, std::false_type) const { std::memcpy(dest, content.begin(), content.size); }
+  void write_to_contiguous(byte_t *dest, std::true_type) const {
+    wire_format<content_t>::compact(content.begin(), dest);
+  }
+};
+
+//! \brief Action request whose payload is a byte sequence forwarded as is
+//!
+//! The payload is padded with zeros up to `Payload_Size` bytes, so the request can be received by an action accepting a
+//! byte buffer of that size.
+template<endianess Endianess, signed_mode Signed_Mode, typename Index_T, std::size_t Payload_Size>
+struct forwarded_message : detail::immediate_writer<forwarded_message<Endianess, Signed_Mode, Index_T, Payload_Size>> {
+  //! \brief Refer to the payload to forward
+  forwarded_message(Index_T index, const byte_t *payload, std::size_t size)
+      : index{index}, payload{payload}, size{size} {}
+
+  using detail::immediate_writer<forwarded_message<Endianess, Signed_Mode, Index_T, Payload_Size>>::write_to;
+
+  //! \brief Completely output the request
+  template<typename Dest_F, UPD_REQUIREMENT(output_invocable, Dest_F)>
+  void write_to(Dest_F &&insert_byte) const {
+    for (auto byte : index)
       insert_byte(byte);
+    for (std::size_t i = 0; i < size; i++)
+      insert_byte(payload[i]);
+    for (std::size_t i = size; i < Payload_Size; i++)
+      insert_byte(byte_t{0});
+  }
+
+  //! \brief Copy the request as a whole into contiguous storage
+  void write_to_contiguous(byte_t *dest) const {
+    std::memcpy(dest, index.begin(), index.size);
+    std::memcpy(dest + index.size, payload, size);
+    std::memset(dest + index.size + size, 0, Payload_Size - size);
   }
 
-  tuple<Endianess, Signed_Mode, Ts...> content;
+  tuple<Endianess, Signed_Mode, Index_T> index;
+  const byte_t *payload;
+  std::size_t size;
 };
 
 } // namespace detail
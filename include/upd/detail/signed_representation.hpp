@@ -35,9 +35,7 @@ T from_signed_mode_impl(unsigned long long value) {
 //! \brief Interpret a sequence of bytes as an integer using the provided signed number representation
 template<typename T, signed_mode Signed_Mode, UPD_REQUIRE(platform_info.signed_mode == Signed_Mode)>
 T from_signed_mode(unsigned long long value) {
-  T retval;
-  memcpy(&retval, &value, sizeof(retval));
-  return retval;
+  return static_cast<T>(value);
 }
 template<typename T, signed_mode Signed_Mode, UPD_REQUIRE(platform_info.signed_mode != Signed_Mode)>
 T from_signed_mode(unsigned long long value) {
@@ -46,20 +44,20 @@ T from_signed_mode(unsigned long long value) {
 
 //! \brief Platform-agnostic implementations of `to_signed_mode`
 template<signed_mode Signed_Mode, typename T, detail::require<Signed_Mode == signed_mode::SIGNED_MAGNITUDE> = 0>
-unsigned long long to_signed_mode_impl(T value) {
+UPD_CONSTEXPR_17 unsigned long long to_signed_mode_impl(T value) {
   constexpr auto sign_mask = 0b10000000ull << 8 * (sizeof(T) - 1);
   return value >= 0 ? static_cast<unsigned long long>(value) : static_cast<unsigned long long>(-value) | sign_mask;
 }
 template<signed_mode Signed_Mode, typename T, detail::require<Signed_Mode == signed_mode::ONES_COMPLEMENT> = 0>
-unsigned long long to_signed_mode_impl(T value) {
+UPD_CONSTEXPR_17 unsigned long long to_signed_mode_impl(T value) {
   return value >= 0 ? static_cast<unsigned long long>(value) : ~static_cast<unsigned long long>(-value);
 }
 template<signed_mode Signed_Mode, typename T, detail::require<Signed_Mode == signed_mode::TWOS_COMPLEMENT> = 0>
-unsigned long long to_signed_mode_impl(T value) {
-  return value >= 0 ? static_cast<unsigned long long>(value) : static_cast<unsigned long long>(~(-value - 1));
+UPD_CONSTEXPR_17 unsigned long long to_signed_mode_impl(T value) {
+  return value >= 0 ? static_cast<unsigned long long>(value) : ~static_cast<unsigned long long>(-(value + 1));
 }
 template<signed_mode Signed_Mode, typename T, detail::require<Signed_Mode == signed_mode::OFFSET_BINARY> = 0>
-unsigned long long to_signed_mode_impl(T value) {
+UPD_CONSTEXPR_17 unsigned long long to_signed_mode_impl(T value) {
   constexpr auto offset = 0b10000000ull << 8 * (sizeof(T) - 1);
   return static_cast<unsigned long long>(value + offset);
 }
@@ -67,10 +65,7 @@ unsigned long long to_signed_mode_impl(T value) {
 //! \brief Serialize an integer using the provided signed number representation
 template<signed_mode Signed_Mode, typename T, UPD_REQUIRE(platform_info.signed_mode == Signed_Mode)>
 unsigned long long to_signed_mode(T value) {
-  unsigned long long retval;
-  memcpy(&retval, &value, sizeof value);
-
-  return retval;
+  return static_cast<unsigned long long>(value);
 }
 template<signed_mode Signed_Mode, typename T, UPD_REQUIRE(platform_info.signed_mode != Signed_Mode)>
 unsigned long long to_signed_mode(T value) {
@@ -0,0 +1,95 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../format.hpp"
+#include "../type.hpp"
+#include "../typelist.hpp"
+#include "../unevaluated.hpp" // IWYU pragma: keep
+#include "type_traits/conjunction.hpp"
+#include "type_traits/flatten_tuple.hpp"
+#include "type_traits/input_tuple.hpp"
+#include "type_traits/remove_cv_ref.hpp"
+#include "type_traits/signature.hpp"
+#include "type_traits/smallest.hpp"
+#include "type_traits/typelist.hpp"
+#include "wire_format.hpp"
+
+// IWYU pragma: no_forward_declare unevaluated
+
+namespace upd {
+namespace detail {
+
+//! \brief Size in bytes of the payload needed to invoke a callback of type `F`
+template<endianess Endianess, signed_mode Signed_Mode, typename F>
+using input_size = std::integral_constant<std::size_t, input_tuple<Endianess, Signed_Mode, F>::size>;
+
+//! \brief Size in bytes of the serialized return value of a callback of type `F`
+template<endianess Endianess, signed_mode Signed_Mode, typename F>
+using output_size = std::integral_constant<
+    std::size_t,
+    flatten_tuple_t<Endianess, Signed_Mode, remove_cv_ref_t<message_return_t<F>>>::size>;
+
+//! \brief Compile-time tables holding the payload sizes of a list of callbacks
+//!
+//! The sizes are stored in arrays of the smallest unsigned integer type able to hold them, so they can be indexed at
+//! runtime by a keyring index without having to store them in each dispatcher instance.
+template<endianess, signed_mode, typename>
+struct size_table;
+
+template<endianess Endianess, signed_mode Signed_Mode, typename... Fs, Fs... Ftors>
+struct size_table<Endianess, Signed_Mode, flist_t<unevaluated<Fs, Ftors>...>> {
+  //! \brief Greatest payload size needed to invoke one of the callbacks
+  constexpr static auto max_input_size = max_p<input_size<Endianess, Signed_Mode, decltype(*Ftors)>...>::value;
+
+  //! \brief Greatest serialized return value size of the callbacks
+  constexpr static auto max_output_size = max_p<output_size<Endianess, Signed_Mode, decltype(*Ftors)>...>::value;
+
+  //! \brief Type of the elements of `input_sizes`
+  using input_size_t = smallest_unsigned_t<max_input_size>;
+
+  //! \brief Type of the elements of `output_sizes`
+  using output_size_t = smallest_unsigned_t<max_output_size>;
+
+  //! \brief Size in bytes of the payload needed to invoke each callback
+  constexpr static input_size_t input_sizes[] = {input_size<Endianess, Signed_Mode, decltype(*Ftors)>::value...};
+
+  //! \brief Size in bytes of the serialized return value of each callback
+  constexpr static output_size_t output_sizes[] = {output_size<Endianess, Signed_Mode, decltype(*Ftors)>::value...};
+
+  //! \brief Whether the payload of some of the callbacks may be shorter than its size
+  constexpr static bool has_variable_inputs =
+      !conjunction<std::integral_constant<
+          bool,
+          !has_variable_length<input_tuple<Endianess, Signed_Mode, decltype(*Ftors)>>::value>...>::value;
+
+  //! \brief Type of the elements of `input_lengths`
+  using input_length_t = std::size_t (*)(const byte_t *, std::size_t);
+
+  //! \brief Functions computing the length of the payload received for each callback
+  //! \see wire_format::length
+  constexpr static input_length_t input_lengths[] = {
+      &wire_format<input_tuple<Endianess, Signed_Mode, decltype(*Ftors)>>::length...};
+};
+
+template<endianess Endianess, signed_mode Signed_Mode, typename... Fs, Fs... Ftors>
+constexpr typename size_table<Endianess, Signed_Mode, flist_t<unevaluated<Fs, Ftors>...>>::input_size_t
+    size_table<Endianess, Signed_Mode, flist_t<unevaluated<Fs, Ftors>...>>::input_sizes[];
+
+template<endianess Endianess, signed_mode Signed_Mode, typename... Fs, Fs... Ftors>
+constexpr typename size_table<Endianess, Signed_Mode, flist_t<unevaluated<Fs, Ftors>...>>::output_size_t
+    size_table<Endianess, Signed_Mode, flist_t<unevaluated<Fs, Ftors>...>>::output_sizes[];
+
+template<endianess Endianess, signed_mode Signed_Mode, typename... Fs, Fs... Ftors>
+constexpr typename size_table<Endianess, Signed_Mode, flist_t<unevaluated<Fs, Ftors>...>>::input_length_t
+    size_table<Endianess, Signed_Mode, flist_t<unevaluated<Fs, Ftors>...>>::input_lengths[];
+
+//! \brief Size tables of the callbacks held by `Keyring`
+template<typename Keyring>
+using keyring_size_table = size_table<Keyring::endianess, Keyring::signed_mode, typename Keyring::flist_t>;
+
+} // namespace detail
+} // namespace upd
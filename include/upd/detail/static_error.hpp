@@ -43,5 +43,6 @@
 #define UPD_ERROR_OUT_OF_BOUND(X) "`" #X "` is an invalid index"
 #define UPD_ERROR_SIGNATURE_MISMATCH(X) "`" #X "` does not match the target signature"
 #define UPD_ERROR_INVALID_KEY(X) "`" #X "` is not a valid `upd::key` instance"
+#define UPD_ERROR_SERIALIZATION_MISMATCH(X) "The parameter of `" #X "` does not match the serialization parameters"
 
 //! @}
@@ -2,14 +2,186 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+
+#include "../../array_view.hpp"
 #include "../../format.hpp"
 #include "../../tuple.hpp"
+#include "../../type.hpp"
 #include "remove_cv_ref.hpp"
 #include "signature.hpp"
+#include "typelist.hpp"
 
 namespace upd {
 namespace detail {
 
+//! \name
+//! \brief Split the output view from the parameters of a callback of signature `S`
+//!
+//! Callbacks whose last parameter is a \ref<tuple_view> tuple_view instance bound to a `byte_t *` iterator write their
+//! result through that view instead of returning it. The type member `type` is an alias for the type of that view (or
+//! for `void` if there is none) and the type member `inputs_t` is an alias for the signature of the callback without
+//! its output view.
+//! @{
+
+template<typename R, typename Ins, typename Last, typename T = remove_cv_ref_t<Last>>
+struct split_output_view_impl;
+template<typename R, typename... Ins, typename Last, typename T>
+struct split_output_view_impl<R, tlist_t<Ins...>, Last, T> {
+  using type = void;
+  using inputs_t = R(Ins..., Last);
+};
+template<typename R, typename... Ins, typename Last, endianess Endianess, signed_mode Signed_Mode, typename... Ts>
+struct split_output_view_impl<R, tlist_t<Ins...>, Last, tuple_view<byte_t *, Endianess, Signed_Mode, Ts...>> {
+  using type = tuple_view<byte_t *, Endianess, Signed_Mode, Ts...>;
+  using inputs_t = R(Ins...);
+};
+
+template<typename R, typename Ins, typename... Args>
+struct split_output_view;
+template<typename R, typename... Ins>
+struct split_output_view<R, tlist_t<Ins...>> {
+  using type = void;
+  using inputs_t = R(Ins...);
+};
+template<typename R, typename... Ins, typename Last>
+struct split_output_view<R, tlist_t<Ins...>, Last> : split_output_view_impl<R, tlist_t<Ins...>, Last> {};
+template<typename R, typename... Ins, typename Arg, typename Next, typename... Args>
+struct split_output_view<R, tlist_t<Ins...>, Arg, Next, Args...>
+    : split_output_view<R, tlist_t<Ins..., Arg>, Next, Args...> {};
+
+template<typename S>
+struct output_view {
+  using type = void;
+  using inputs_t = S;
+};
+template<typename R, typename... Args>
+struct output_view<R(Args...)> : split_output_view<R, tlist_t<>, Args...> {};
+
+//! @}
+
+//! \brief Alias for `typename output_view<signature_t<F>>::type`
+template<typename F>
+using output_view_t = typename output_view<signature_t<F>>::type;
+
+//! \brief Alias for `typename output_view<signature_t<F>>::inputs_t`
+template<typename F>
+using inputs_signature_t = typename output_view<signature_t<F>>::inputs_t;
+
+//! \name
+//! \brief Type of the \ref<tuple_view> tuple_view instance accepted as input by a callback of signature `S`
+//!
+//! Callbacks whose only input parameter is a \ref<tuple_view> tuple_view instance are invoked on a view bound to the
+//! payload instead of the unserialized values. For any other signature, the type member `type` is an alias for `void`.
+//! @{
+
+template<typename S>
+struct handler_view {
+  using type = void;
+};
+template<typename R, typename Arg>
+struct handler_view<R(Arg)> : handler_view<remove_cv_ref_t<Arg>> {};
+template<typename It, endianess Endianess, signed_mode Signed_Mode, typename... Ts>
+struct handler_view<tuple_view<It, Endianess, Signed_Mode, Ts...>> {
+  using type = tuple_view<It, Endianess, Signed_Mode, Ts...>;
+};
+
+//! @}
+
+//! \brief Alias for `typename handler_view<inputs_signature_t<F>>::type`
+template<typename F>
+using handler_view_t = typename handler_view<inputs_signature_t<F>>::type;
+
+//! \name
+//! \brief Signature of the parameters unserialized to invoke a callback of signature `S`
+//!
+//! It is the same signature, except for callbacks accepting a \ref<tuple_view> tuple_view instance, whose parameters
+//! are the values viewed.
+//! @{
+
+template<typename S, typename View = typename handler_view<S>::type>
+struct parameters_signature {
+  using type = S;
+};
+template<typename R, typename Arg, typename It, endianess Endianess, signed_mode Signed_Mode, typename... Ts>
+struct parameters_signature<R(Arg), tuple_view<It, Endianess, Signed_Mode, Ts...>> {
+  using type = R(Ts...);
+};
+
+//! @}
+
+//! \brief Alias for `typename parameters_signature<inputs_signature_t<F>>::type`
+template<typename F>
+using parameters_signature_t = typename parameters_signature<inputs_signature_t<F>>::type;
+
+//! \name
+//! \brief Type of the value sent in packets for a parameter of type `Arg`
+//!
+//! \ref<array_view> array_view instances are sent as the plain array they are viewing (taken by reference, since
+//! array parameters would decay to pointers).
+//! @{
+
+template<typename Arg, typename T = remove_cv_ref_t<Arg>>
+struct message_parameter {
+  using type = Arg;
+};
+template<typename Arg, typename T, std::size_t N, endianess Endianess, signed_mode Signed_Mode>
+struct message_parameter<Arg, array_view<T, N, Endianess, Signed_Mode>> {
+  using type = const T (&)[N];
+};
+
+//! @}
+
+//! \name
+//! \brief Type of the value sent back in packets by a callback returning `R` and writing into `View`
+//!
+//! Arrays written into an output view are sent back as `std::array` instances, since functions cannot return plain
+//! arrays.
+//! @{
+
+template<typename R, typename View>
+struct message_return {
+  using type = R;
+};
+template<typename R, endianess Endianess, signed_mode Signed_Mode, typename... Ts>
+struct message_return<R, tuple_view<byte_t *, Endianess, Signed_Mode, Ts...>> {
+  static_assert(sizeof...(Ts) == 1, "Output views must hold exactly one value");
+};
+template<typename R, endianess Endianess, signed_mode Signed_Mode, typename T>
+struct message_return<R, tuple_view<byte_t *, Endianess, Signed_Mode, T>> {
+  using type = T;
+};
+template<typename R, endianess Endianess, signed_mode Signed_Mode, typename T, std::size_t N>
+struct message_return<R, tuple_view<byte_t *, Endianess, Signed_Mode, T[N]>> {
+  using type = std::array<T, N>;
+};
+
+//! @}
+
+//! \name
+//! \brief Signature of the packets invoking a callback of signature `S` with output view `View`
+//! @{
+
+template<typename S, typename View>
+struct message_signature {
+  using type = S;
+};
+template<typename R, typename... Args, typename View>
+struct message_signature<R(Args...), View> {
+  using type = typename message_return<R, View>::type(typename message_parameter<Args>::type...);
+};
+
+//! @}
+
+//! \brief Signature of the packets invoking a callback of type `F`
+template<typename F>
+using message_signature_t = typename message_signature<parameters_signature_t<F>, output_view_t<F>>::type;
+
+//! \brief Type of the value sent back in packets by a callback of type `F`
+template<typename F>
+using message_return_t = typename examine_invocable<message_signature_t<F>>::return_type;
+
 template<typename, endianess, signed_mode>
 struct input_tuple_impl;
 
@@ -20,7 +192,7 @@ struct input_tuple_impl<R(Args...), Endianess, Signed_Mode> {
 
 //! \brief Template instance of `tuple` suitable for holding the parameters of an invocable of type `F`
 template<endianess Endianess, signed_mode Signed_Mode, typename F>
-using input_tuple = typename input_tuple_impl<signature_t<F>, Endianess, Signed_Mode>::type;
+using input_tuple = typename input_tuple_impl<parameters_signature_t<F>, Endianess, Signed_Mode>::type;
 
 } // namespace detail
 } // namespace upd
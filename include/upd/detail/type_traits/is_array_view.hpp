@@ -0,0 +1,29 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../../format.hpp"
+
+namespace upd {
+
+template<typename, std::size_t, endianess, signed_mode>
+class array_view; // IWYU pragma: keep
+
+namespace detail {
+
+//! \name
+//! \brief Check if `T` is a template instance of `array_view`
+//! @{
+
+template<typename T>
+struct is_array_view : std::false_type {};
+template<typename T, std::size_t N, endianess Endianess, signed_mode Signed_Mode>
+struct is_array_view<array_view<T, N, Endianess, Signed_Mode>> : std::true_type {};
+
+//! @}
+
+} // namespace detail
+} // namespace upd
@@ -0,0 +1,32 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace upd {
+
+template<typename, std::size_t>
+class bounded_vector; // IWYU pragma: keep
+
+template<std::size_t>
+class bounded_string; // IWYU pragma: keep
+
+namespace detail {
+
+//! \name
+//! \brief Check if `T` is a template instance of `bounded_vector` or `bounded_string`
+//! @{
+
+template<typename T>
+struct is_bounded_vector : std::false_type {};
+template<typename T, std::size_t N>
+struct is_bounded_vector<bounded_vector<T, N>> : std::true_type {};
+template<std::size_t N>
+struct is_bounded_vector<bounded_string<N>> : std::true_type {};
+
+//! @}
+
+} // namespace detail
+} // namespace upd
@@ -0,0 +1,52 @@
+//! \file
+
+#pragma once
+
+#include <type_traits>
+
+#include "../../upd.hpp"
+#include "detector.hpp"
+#include "is_user_serializable.hpp"
+
+namespace upd {
+
+class half; // IWYU pragma: keep
+
+template<typename, unsigned long long>
+class fixed; // IWYU pragma: keep
+
+template<typename T, T, T>
+class ranged; // IWYU pragma: keep
+
+namespace detail {
+
+UPD_DETAIL_MAKE_DETECTOR(has_enum_range_impl,
+                         UPD_PACK(typename T),
+                         UPD_PACK(typename = decltype(upd_enum_range<T>::min, upd_enum_range<T>::max)))
+
+//! \brief Indicates whether `T` is an enumeration type whose range is provided by a specialization of `upd_enum_range`
+template<typename T>
+struct has_enum_range
+    : std::integral_constant<bool,
+                             std::is_enum<T>::value && decltype(has_enum_range_impl<T>(0))::value &&
+                                 !is_user_serializable<T>::value> {};
+
+//! \name
+//! \brief Check if `T` is serialized as an integer representation of its values
+//!
+//! Such types are `half`, the template instances of `fixed` and `ranged`, and the enumeration types with a range.
+//! @{
+
+template<typename T>
+struct is_integer_backed : has_enum_range<T> {};
+template<>
+struct is_integer_backed<half> : std::true_type {};
+template<typename T, unsigned long long Scale>
+struct is_integer_backed<fixed<T, Scale>> : std::true_type {};
+template<typename T, T Min, T Max>
+struct is_integer_backed<ranged<T, Min, Max>> : std::true_type {};
+
+//! @}
+
+} // namespace detail
+} // namespace upd
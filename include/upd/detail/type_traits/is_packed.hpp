@@ -0,0 +1,26 @@
+//! \file
+
+#pragma once
+
+#include <type_traits>
+
+namespace upd {
+
+template<typename...>
+class packed; // IWYU pragma: keep
+
+namespace detail {
+
+//! \name
+//! \brief Check if `T` is a template instance of `packed`
+//! @{
+
+template<typename T>
+struct is_packed : std::false_type {};
+template<typename... Ts>
+struct is_packed<packed<Ts...>> : std::true_type {};
+
+//! @}
+
+} // namespace detail
+} // namespace upd
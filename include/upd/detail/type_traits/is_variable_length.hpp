@@ -0,0 +1,18 @@
+//! \file
+
+#pragma once
+
+#include <type_traits>
+
+#include "is_bounded_vector.hpp"
+#include "is_varint.hpp"
+
+namespace upd {
+namespace detail {
+
+//! \brief Indicates whether the wire representation of values of type `T` may be shorter than their storage
+template<typename T>
+struct is_variable_length : std::integral_constant<bool, is_varint<T>::value || is_bounded_vector<T>::value> {};
+
+} // namespace detail
+} // namespace upd
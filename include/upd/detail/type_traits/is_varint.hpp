@@ -0,0 +1,26 @@
+//! \file
+
+#pragma once
+
+#include <type_traits>
+
+namespace upd {
+
+template<typename>
+class varint; // IWYU pragma: keep
+
+namespace detail {
+
+//! \name
+//! \brief Check if `T` is a template instance of `varint`
+//! @{
+
+template<typename T>
+struct is_varint : std::false_type {};
+template<typename T>
+struct is_varint<varint<T>> : std::true_type {};
+
+//! @}
+
+} // namespace detail
+} // namespace upd
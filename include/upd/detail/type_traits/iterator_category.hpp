@@ -2,6 +2,11 @@
 
 #pragma once
 
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "../../type.hpp"
 #include "../../upd.hpp"
 #include "detector.hpp"
 #include "require.hpp"
@@ -24,5 +29,48 @@ struct is_input_byte_iterator : decltype(is_input_byte_iterator_impl<T>(0)) {};
 template<typename T>
 struct is_output_byte_iterator : decltype(is_output_byte_iterator_impl<T>(0)) {};
 
+//! \name
+//! \brief Check if `T` is an iterator to contiguous storage of byte-sized objects
+//!
+//! Pointers and `std::vector` iterators are always recognized. From C++20, any type modeling
+//! `std::contiguous_iterator` is recognized as well.
+//! @{
+
+template<typename V, bool = std::is_object<V>::value>
+struct is_byte_object : std::integral_constant<bool,
+                                               sizeof(V) == 1 && std::is_trivially_copyable<V>::value &&
+                                                   !std::is_same<V, bool>::value> {};
+template<typename V>
+struct is_byte_object<V, false> : std::false_type {};
+
+template<typename T,
+         typename V = typename std::remove_cv<typename std::iterator_traits<T>::value_type>::type,
+         require<is_byte_object<V>::value> = 0>
+constexpr bool is_contiguous_byte_iterator_impl(int) {
+#if __cplusplus >= 202002L
+  return std::contiguous_iterator<T> || std::is_same<T, typename std::vector<V>::iterator>::value ||
+         std::is_same<T, typename std::vector<V>::const_iterator>::value;
+#else  // __cplusplus >= 202002L
+  return std::is_pointer<T>::value || std::is_same<T, typename std::vector<V>::iterator>::value ||
+         std::is_same<T, typename std::vector<V>::const_iterator>::value;
+#endif // __cplusplus >= 202002L
+}
+template<typename T>
+constexpr bool is_contiguous_byte_iterator_impl(...) {
+  return false;
+}
+
+template<typename T>
+struct is_contiguous_byte_iterator : std::integral_constant<bool, is_contiguous_byte_iterator_impl<T>(0)> {};
+
+//! @}
+
+//! \brief Address of the byte designated by an iterator to contiguous storage
+//! \return a `const byte_t *` pointer if the designated byte is const-qualified, a `byte_t *` pointer otherwise
+template<typename It, typename V = typename std::remove_reference<decltype(*std::declval<const It &>())>::type>
+typename std::conditional<std::is_const<V>::value, const byte_t *, byte_t *>::type address_of(const It &it) {
+  return reinterpret_cast<typename std::conditional<std::is_const<V>::value, const byte_t *, byte_t *>::type>(&*it);
+}
+
 } // namespace detail
 } // namespace upd
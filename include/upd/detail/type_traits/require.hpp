@@ -8,10 +8,16 @@
 #include "../../format.hpp"
 #include "../../type.hpp"
 #include "is_array.hpp"
+#include "is_array_view.hpp"
+#include "is_bounded_vector.hpp"
+#include "is_integer_backed.hpp"
 #include "is_key.hpp"
 #include "is_keyring.hpp"
+#include "is_packed.hpp"
 #include "is_tuple.hpp"
 #include "is_user_serializable.hpp"
+#include "is_variable_length.hpp"
+#include "is_varint.hpp"
 #include "signature.hpp"
 #include "typelist.hpp"
 
@@ -96,11 +102,17 @@ using require_invocable = require<is_invocable<T>::value>;
 
 //! \brief Require the provided type to be an unsigned integer type
 template<typename T, typename U = int>
-using require_unsigned_integer = require<std::is_unsigned<T>::value, U>;
+using require_unsigned_integer = require<std::is_integral<T>::value && std::is_unsigned<T>::value, U>;
 
 //! \brief Require the provided type to be a signed integer type
 template<typename T, typename U = int>
-using require_signed_integer = require<std::is_signed<T>::value, U>;
+using require_signed_integer = require<std::is_integral<T>::value && std::is_signed<T>::value, U>;
+
+//! \brief Require the provided type to be a floating-point type of 4 or 8 bytes
+template<typename T, typename U = int>
+using require_floating_point =
+    require<std::is_floating_point<T>::value && (sizeof(T) == 4 || sizeof(T) == 8) && !is_user_serializable<T>::value,
+            U>;
 
 //! \brief Require the provided type to be an bounded array type
 template<typename T, typename U = int>
@@ -110,6 +122,38 @@ using require_array = require<detail::is_array<T>::value, U>;
 template<typename T, typename U = int>
 using require_not_array = require<!detail::is_array<T>::value, U>;
 
+//! \brief Require the provided type to be a template instance of `array_view`
+template<typename T, typename U = int>
+using require_is_array_view = require<is_array_view<T>::value, U>;
+
+//! \brief Require the provided type not to be a template instance of `array_view`
+template<typename T, typename U = int>
+using require_not_array_view = require<!is_array_view<T>::value, U>;
+
+//! \brief Require the provided type to be a template instance of `varint`
+template<typename T, typename U = int>
+using require_is_varint = require<is_varint<T>::value, U>;
+
+//! \brief Require the provided type to be a template instance of `bounded_vector` or `bounded_string`
+template<typename T, typename U = int>
+using require_is_bounded_vector = require<is_bounded_vector<T>::value, U>;
+
+//! \brief Require the wire representation of the provided type to have the same length as its storage
+template<typename T, typename U = int>
+using require_fixed_length = require<!is_variable_length<T>::value, U>;
+
+//! \brief Require the provided type to be serialized as an integer representation of its values
+template<typename T, typename U = int>
+using require_is_integer_backed = require<is_integer_backed<T>::value, U>;
+
+//! \brief Require the provided type not to be serialized as an integer representation of its values
+template<typename T, typename U = int>
+using require_not_integer_backed = require<!is_integer_backed<T>::value, U>;
+
+//! \brief Require the provided type to be a template instance of `packed`
+template<typename T, typename U = int>
+using require_is_packed = require<is_packed<T>::value, U>;
+
 //! \brief Require the provided type not to be a pointer type
 template<typename T, typename U = int>
 using require_not_pointer = require<!std::is_pointer<T>::value, U>;
@@ -0,0 +1,176 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "../bounded_vector.hpp"
+#include "../format.hpp"
+#include "../tuple.hpp"
+#include "../type.hpp"
+#include "../varint.hpp"
+#include "type_traits/conjunction.hpp"
+#include "type_traits/is_variable_length.hpp"
+#include "type_traits/is_varint.hpp"
+#include "type_traits/require.hpp"
+#include "type_traits/typelist.hpp"
+
+namespace upd {
+namespace detail {
+
+//! \name
+//! \brief Length in bytes of the wire representation of a value of type `T` stored at `src`
+//!
+//! The wire representation of a value is the part of its serialized representation which is actually sent, that is its
+//! whole serialized representation unless `T` is a variable-length type. Only the first `available` bytes of `src`
+//! are inspected: if they do not hold the whole wire representation, a lower bound of its length greater than
+//! `available` is returned instead.
+//! @{
+
+template<typename T, require_fixed_length<T> = 0>
+std::size_t wire_length(const byte_t *, std::size_t) {
+  return serialization_size<T>::value;
+}
+template<typename T, require_is_varint<T> = 0>
+std::size_t wire_length(const byte_t *src, std::size_t available) {
+  return varint_length<typename T::value_type>(src, available);
+}
+template<typename T, require_is_bounded_vector<T> = 0>
+std::size_t wire_length(const byte_t *src, std::size_t available) {
+  return bounded_vector_length<T>(src, available);
+}
+
+//! @}
+
+//! \name
+//! \brief Indicates whether the wire representation of `Tuple` may be shorter than its storage
+//! @{
+
+template<typename Tuple>
+struct has_variable_length;
+template<endianess Endianess, signed_mode Signed_Mode, typename... Ts>
+struct has_variable_length<tuple<Endianess, Signed_Mode, Ts...>>
+    : std::integral_constant<bool,
+                             !conjunction<std::integral_constant<bool, !is_variable_length<Ts>::value>...>::value> {};
+
+//! @}
+
+//! \brief Conversions between the storage of a \ref<tuple> tuple instance and its wire representation
+//!
+//! The wire representation of a tuple is the wire representation of its values laid out back to back. Unless the tuple
+//! holds variable-length values, it is the same as its storage.
+template<typename Tuple, typename Fields = typename Tuple::plan_t::fields_t>
+struct wire_format;
+template<typename Tuple, typename... Fields>
+struct wire_format<Tuple, tlist_t<Fields...>> {
+  //! \brief Length in bytes of the wire representation held by `src`
+  //!
+  //! If the first `available` bytes of `src` do not hold the whole wire representation, a lower bound of its length
+  //! greater than `available` is returned instead.
+  static std::size_t length(const byte_t *src, std::size_t available) {
+    using discard = int[];
+    std::size_t pos = 0;
+
+    (void)discard{0, (pos = next_length<Fields>(src, available, pos), 0)...};
+    return pos;
+  }
+
+  //! \brief Length in bytes of the wire representation of a storage
+  static std::size_t size(const byte_t *storage) {
+    using discard = int[];
+    std::size_t pos = 0;
+
+    (void)discard{0, (pos += field_length<Fields>(storage + Fields::offset), 0)...};
+    return pos;
+  }
+
+  //! \brief Copy a whole wire representation into a storage
+  //! \return the length of the wire representation
+  static std::size_t expand(const byte_t *src, byte_t *storage) {
+    using discard = int[];
+    std::size_t pos = 0;
+
+    (void)discard{0, (pos += expand_field<Fields>(src + pos, storage), 0)...};
+    return pos;
+  }
+
+  //! \brief Copy the wire representation of a storage into `dest`
+  //!
+  //! `dest` may be `storage` itself, in which case the storage is compacted in place.
+  //!
+  //! \return the length of the wire representation
+  static std::size_t compact(const byte_t *storage, byte_t *dest) {
+    using discard = int[];
+    std::size_t pos = 0;
+
+    (void)discard{0, (pos += compact_field<Fields>(storage, dest + pos), 0)...};
+    return pos;
+  }
+
+  //! \brief Load a storage from the wire representation output by a byte getter
+  //!
+  //! No byte is fetched past the end of the wire representation.
+  template<typename Src>
+  static void load(Src &src, byte_t *storage) {
+    using discard = int[];
+    (void)discard{0, (load_field<Fields>(src, storage + Fields::offset), 0)...};
+  }
+
+  //! \brief Output the wire representation of a storage through a byte putter
+  template<typename Dest>
+  static void emit(const byte_t *storage, Dest &dest) {
+    using discard = int[];
+    (void)discard{0, (emit_field<Fields>(storage + Fields::offset, dest), 0)...};
+  }
+
+private:
+  //! \brief Add the length of the value of `Field` to `pos`, unless the previous values were already incomplete
+  template<typename Field>
+  static std::size_t next_length(const byte_t *src, std::size_t available, std::size_t pos) {
+    return pos <= available ? pos + wire_length<typename Field::type>(src + pos, available - pos) : pos;
+  }
+
+  template<typename Field>
+  static std::size_t field_length(const byte_t *field) {
+    return wire_length<typename Field::type>(field, serialization_size<typename Field::type>::value);
+  }
+
+  template<typename Field>
+  static std::size_t expand_field(const byte_t *src, byte_t *storage) {
+    auto size = field_length<Field>(src);
+    std::memcpy(storage + Field::offset, src, size);
+    return size;
+  }
+
+  template<typename Field>
+  static std::size_t compact_field(const byte_t *storage, byte_t *dest) {
+    auto size = field_length<Field>(storage + Field::offset);
+    std::memmove(dest, storage + Field::offset, size);
+    return size;
+  }
+
+  //! \brief Fetch the wire representation of the value of `Field` into `field`
+  //!
+  //! The length is only computed from the bytes fetched so far, so `field` is not inspected before it is loaded.
+  template<typename Field, typename Src>
+  static void load_field(Src &src, byte_t *field) {
+    std::size_t loaded = 0;
+    for (auto size = wire_length<typename Field::type>(nullptr, 0); size > loaded;
+         size = wire_length<typename Field::type>(field, loaded)) {
+      while (loaded < size)
+        field[loaded++] = src();
+    }
+  }
+
+  template<typename Field, typename Dest>
+  static void emit_field(const byte_t *field, Dest &dest) {
+    auto size = field_length<Field>(field);
+    for (std::size_t i = 0; i < size; i++)
+      dest(field[i]);
+  }
+};
+
+} // namespace detail
+} // namespace upd
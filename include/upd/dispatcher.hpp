@@ -2,11 +2,14 @@
 
 #pragma once
 
+#include <cstddef>
 #include <type_traits>
 
 #include "action.hpp"
 #include "detail/io/immediate_process.hpp"
+#include "detail/size_table.hpp"
 #include "detail/static_error.hpp"
+#include "detail/type_traits/input_tuple.hpp"
 #include "detail/type_traits/is_keyring.hpp"
 #include "detail/type_traits/require.hpp"
 #include "detail/type_traits/signature.hpp"
@@ -75,6 +78,76 @@ struct actions {
 //!
 enum class packet_status { LOADING_PACKET, DROPPED_PACKET, RESOLVED_PACKET };
 
+//! \brief Outcome of the processing of one packet of a batch
+//!
+//! `offset` and `size` locate the serialized result of the packet in the output buffer. A dropped packet does not
+//! produce any result, thus its `size` is zero.
+struct batch_entry {
+  packet_status status;
+  std::size_t offset;
+  std::size_t size;
+};
+
+//! \brief Outcome of the processing of a batch of packets
+struct batch_result {
+  //! \brief Number of bytes read from the input buffer
+  std::size_t consumed;
+
+  //! \brief Number of bytes written to the output buffer
+  std::size_t written;
+
+  //! \brief Number of processed packets, which is also the number of filled \ref<batch_entry> batch_entry instances
+  std::size_t count;
+};
+
+namespace detail {
+
+//! \brief Process the packets stored back to back in `input` and write their results back to back into `output`
+//!
+//! The processing stops when the input buffer is exhausted, when the next packet is incomplete, when its result would
+//! not fit in the output buffer or when `max_entries` packets have been processed. As for buffered dispatchers, an
+//! invalid index makes only the bytes of that index dropped.
+template<typename Dispatcher>
+batch_result dispatch_batch(const Dispatcher &dispatcher,
+                            const byte_t *input,
+                            std::size_t input_length,
+                            byte_t *output,
+                            std::size_t output_length,
+                            batch_entry *entries,
+                            std::size_t max_entries) {
+  using index_t = typename Dispatcher::index_t;
+
+  batch_result result{0, 0, 0};
+  while (result.count < max_entries && input_length - result.consumed >= sizeof(index_t)) {
+    const auto *ptr = input + result.consumed;
+    auto index = dispatcher.get_index([&]() { return *ptr++; });
+    auto &entry = entries[result.count];
+
+    if (index >= Dispatcher::size) {
+      entry = batch_entry{packet_status::DROPPED_PACKET, result.written, 0};
+      result.consumed += sizeof(index_t);
+      ++result.count;
+      continue;
+    }
+
+    auto available = input_length - result.consumed - sizeof(index_t);
+    auto payload_size = dispatcher.input_length(index, ptr, available);
+    if (available < payload_size ||
+        output_length - result.written < dispatcher.output_size(index))
+      break;
+
+    auto written = dispatcher.call(index, ptr, output + result.written);
+    entry = batch_entry{packet_status::RESOLVED_PACKET, result.written, written};
+    result.consumed += sizeof(index_t) + payload_size;
+    result.written += written;
+    ++result.count;
+  }
+
+  return result;
+}
+
+} // namespace detail
+
 //! \brief Action container able to accept and process action requests
 //!
 //! A dispatcher is constructed from a \ref<keyring> keyring instance and is able to unserialize a payload serialized by
@@ -134,6 +207,57 @@ public:
     return index;
   }
 
+  //! \brief Extract an index from a packet held in contiguous storage then invoke the action with that index
+  //!
+  //! The action is invoked on the payload in place and its result is written to `output` as a whole.
+  //!
+  //! \param input Beginning of the packet
+  //! \param output Beginning of the storage receiving the serialized result
+  //! \return the index of the called action
+  index_t process_contiguous(const byte_t *input, byte_t *output) {
+    auto index = get_index([&]() { return *input++; });
+
+    if (index < size)
+      call(index, input, output);
+
+    return index;
+  }
+
+  //! \brief Invoke the action with the provided index on a contiguous payload
+  //! \param index Index of the action
+  //! \param input Beginning of the payload (without the index)
+  //! \param output Beginning of the buffer receiving the serialized result
+  //! \return the number of bytes written to `output`
+  //! \warning No bound check is performed.
+  std::size_t call(index_t index, const byte_t *input, byte_t *output) const {
+    return m_actions.content[index].call(input, output);
+  }
+
+  //! \brief Process a batch of packets stored back to back
+  //!
+  //! Every complete packet of `input` is processed in order and the serialized results are appended to `output`. For
+  //! each processed packet, a \ref<batch_entry> batch_entry instance is written to `entries`, indicating whether the
+  //! packet was resolved or dropped and where its result lies in `output`. The processing stops as soon as the next
+  //! packet is incomplete, its result would not fit in `output` or `max_entries` packets have been processed, so the
+  //! remaining bytes can be processed later on.
+  //!
+  //! \param input Beginning of the packets
+  //! \param input_length Size in bytes of the packets
+  //! \param output Beginning of the buffer receiving the results
+  //! \param output_length Size in bytes of `output`
+  //! \param entries Beginning of the array receiving the outcome of each packet
+  //! \param max_entries Size of `entries`
+  //! \return a \ref<batch_result> batch_result instance
+  //! \warning `input` and `output` must not overlap.
+  batch_result dispatch_batch(const byte_t *input,
+                              std::size_t input_length,
+                              byte_t *output,
+                              std::size_t output_length,
+                              batch_entry *entries,
+                              std::size_t max_entries) const {
+    return detail::dispatch_batch(*this, input, input_length, output, output_length, entries, max_entries);
+  }
+
   //! \brief Extract an index from a byte sequence and get the action with that index
   //! \param src Byte getter
   //! \return Either a reference to the action if it exists or `nullptr`
@@ -148,7 +272,7 @@ public:
   //! \return The extracted index
   template<typename Src, UPD_REQUIREMENT(input_invocable, Src)>
   index_t get_index(Src &&src) const {
-    tuple<endianess, signed_mode, index_t> index_tuple;
+    tuple<endianess, signed_mode, index_t> index_tuple{uninitialized};
 
     for (auto &byte : index_tuple)
       byte = src();
@@ -162,7 +286,7 @@ public:
   template<index_t Index, typename F, F Ftor>
   void replace(unevaluated<F, Ftor>) {
     static_assert(Index < size, UPD_ERROR_OUT_OF_BOUND(Index));
-    static_assert(std::is_same<detail::at<signatures_t, Index>, detail::signature_t<F>>::value,
+    static_assert(std::is_same<detail::at<signatures_t, Index>, detail::message_signature_t<F>>::value,
                   UPD_ERROR_SIGNATURE_MISMATCH(Ftor));
 
     m_actions.content[Index] = detail::make_action<Action_Features, F, Ftor, endianess, signed_mode>();
@@ -175,7 +299,7 @@ public:
   template<index_t Index, auto &Ftor>
   void replace() {
     static_assert(Index < size, UPD_ERROR_OUT_OF_BOUND(Index));
-    static_assert(std::is_same<detail::at<signatures_t, Index>, detail::signature_t<decltype(Ftor)>>::value,
+    static_assert(std::is_same<detail::at<signatures_t, Index>, detail::message_signature_t<decltype(Ftor)>>::value,
                   UPD_ERROR_SIGNATURE_MISMATCH(Ftor));
 
     replace<Index>(unevaluated<decltype(Ftor) &, Ftor>{});
@@ -188,12 +312,44 @@ public:
   template<index_t Index, typename F, UPD_REQUIRE_CLASS(Action_Features == action_features::ANY)>
   void replace(F &&ftor) {
     static_assert(Index < size, UPD_ERROR_OUT_OF_BOUND(Index));
-    static_assert(std::is_same<detail::at<signatures_t, Index>, detail::signature_t<F>>::value,
+    static_assert(std::is_same<detail::at<signatures_t, Index>, detail::message_signature_t<F>>::value,
                   UPD_ERROR_SIGNATURE_MISMATCH(ftor));
 
     m_actions.content[Index] = action{UPD_FWD(ftor), endianess_h<endianess>{}, signed_mode_h<signed_mode>{}};
   }
 
+  //! \brief Get the size in bytes of the payload needed to invoke an action
+  //!
+  //! The size is read from a table shared by every dispatcher using the same keyring.
+  //!
+  //! \param index Index of an action
+  //! \warning No bound check is performed.
+  static std::size_t input_size(index_t index) { return size_table_t::input_sizes[index]; }
+
+  //! \brief Get the size in bytes of the serialized return value of an action
+  //!
+  //! The size is read from a table shared by every dispatcher using the same keyring.
+  //!
+  //! \param index Index of an action
+  //! \warning No bound check is performed.
+  static std::size_t output_size(index_t index) { return size_table_t::output_sizes[index]; }
+
+  //! \brief Get the length in bytes of a payload received to invoke an action
+  //!
+  //! The payload of actions with variable-length parameters may be shorter than input_size(). Their length is then
+  //! determined from the beginning of the payload: if the first `available` bytes do not hold the whole payload, a
+  //! lower bound of its length greater than `available` is returned instead. The length of any other payload is its
+  //! size.
+  //!
+  //! \param index Index of an action
+  //! \param payload Beginning of the payload (without the index)
+  //! \param available Number of bytes of the payload which have been received
+  //! \warning No bound check is performed.
+  static std::size_t input_length(index_t index, const byte_t *payload, std::size_t available) {
+    return size_table_t::has_variable_inputs ? size_table_t::input_lengths[index](payload, available)
+                                              : input_size(index);
+  }
+
   //! \brief Get one of the stored actions
   //! \param index Index of an action
   //! \return the action associated with that index
@@ -204,6 +360,8 @@ public:
   const action_t &operator[](index_t index) const { return m_actions.content[index]; }
 
 private:
+  using size_table_t = detail::keyring_size_table<Keyring>;
+
   detail::actions<index_t, size, Action_Features> m_actions;
 };
 
@@ -0,0 +1,78 @@
+//! \file
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace upd {
+
+//! \brief Real number sent on the wire as an integer number of `1 / Scale` units
+//!
+//! Fixed values suit real numbers whose range and resolution are known: a `fixed<std::int16_t, 100>` holds values from
+//! `-327.68` to `327.67` by steps of `0.01` and is serialized in two bytes. Values are rounded to the nearest multiple
+//! of `1 / Scale` and saturated to the range of `T` when a fixed value is made. The serialization parameters apply to
+//! the underlying integer.
+//!
+//! \tparam T Integer type of the serialized representation
+//! \tparam Scale Number of representation units per unit of the value
+template<typename T, unsigned long long Scale>
+class fixed {
+  static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value,
+                "Fixed-point values must be represented by an integer type");
+  static_assert(Scale > 0, "The scale of fixed-point values must be positive");
+
+public:
+  //! \brief Type of the serialized representation
+  using representation_t = T;
+
+  //! \brief Number of representation units per unit of the value
+  constexpr static unsigned long long scale = Scale;
+
+  fixed() = default;
+
+  //! \brief Hold a value
+  fixed(double value) : m_representation{encode(value)} {}
+
+  //! \brief Get the value
+  //!
+  //! The value is computed in double precision, so that representations wider than the significand of a `float` keep
+  //! their resolution.
+  double value() const { return static_cast<double>(m_representation) / Scale; }
+
+  //! \copydoc value
+  operator double() const { return value(); }
+
+  //! \brief Get the number of `1 / Scale` units of the value
+  representation_t representation() const { return m_representation; }
+
+  //! \brief Make a fixed value from a number of `1 / Scale` units
+  static fixed from_representation(representation_t representation) {
+    fixed retval;
+    retval.m_representation = representation;
+
+    return retval;
+  }
+
+private:
+  static representation_t encode(double value) {
+    auto units = std::nearbyint(value * Scale);
+
+    if (std::isnan(units))
+      return 0;
+    if (units <= static_cast<double>(std::numeric_limits<T>::min()))
+      return std::numeric_limits<T>::min();
+    if (units >= static_cast<double>(std::numeric_limits<T>::max()))
+      return std::numeric_limits<T>::max();
+
+    return static_cast<representation_t>(units);
+  }
+
+  representation_t m_representation = 0;
+};
+
+template<typename T, unsigned long long Scale>
+constexpr unsigned long long fixed<T, Scale>::scale;
+
+} // namespace upd
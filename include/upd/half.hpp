@@ -0,0 +1,80 @@
+//! \file
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#elif defined(__ARM_FP16_FORMAT_IEEE)
+#include <cstring>
+#endif
+
+#include "detail/ieee754.hpp"
+
+namespace upd {
+
+//! \brief Floating-point value sent on the wire in the IEEE 754 binary16 format
+//!
+//! Half values hold about three significant digits and are serialized in two bytes instead of four. Values are rounded
+//! to the nearest representable value when a half value is made, using the F16C instructions or the ARM `__fp16` type
+//! when available. Only the endianess serialization parameter applies to half values.
+class half {
+public:
+  //! \brief Type of the serialized representation
+  using representation_t = std::uint16_t;
+
+  half() = default;
+
+  //! \brief Hold a value
+  half(float value) : m_bits{encode(value)} {}
+
+  //! \brief Get the value
+  float value() const { return decode(m_bits); }
+
+  //! \copydoc value
+  operator float() const { return value(); }
+
+  //! \brief Get the binary16 representation of the value
+  representation_t representation() const { return m_bits; }
+
+  //! \brief Make a half value from its binary16 representation
+  static half from_representation(representation_t bits) {
+    half retval;
+    retval.m_bits = bits;
+
+    return retval;
+  }
+
+private:
+  static representation_t encode(float value) {
+#if defined(__F16C__)
+    return static_cast<representation_t>(_cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT));
+#elif defined(__ARM_FP16_FORMAT_IEEE)
+    __fp16 h = value;
+    representation_t retval;
+    std::memcpy(&retval, &h, sizeof retval);
+
+    return retval;
+#else
+    return static_cast<representation_t>(detail::encode_binary<2>(value));
+#endif
+  }
+
+  static float decode(representation_t bits) {
+#if defined(__F16C__)
+    return _cvtsh_ss(bits);
+#elif defined(__ARM_FP16_FORMAT_IEEE)
+    __fp16 h;
+    std::memcpy(&h, &bits, sizeof h);
+
+    return h;
+#else
+    return static_cast<float>(detail::decode_binary<2>(bits));
+#endif
+  }
+
+  representation_t m_bits = 0;
+};
+
+} // namespace upd
@@ -2,15 +2,20 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <type_traits>
 
 #include "action.hpp"
 #include "detail/io/immediate_reader.hpp"
 #include "detail/serialized_message.hpp"
 #include "detail/static_error.hpp"
+#include "detail/type_traits/index_sequence.hpp"
+#include "detail/type_traits/iterator_category.hpp"
 #include "detail/type_traits/remove_cv_ref.hpp"
 #include "detail/type_traits/require.hpp"
 #include "detail/type_traits/signature.hpp"
+#include "detail/wire_format.hpp"
 #include "format.hpp"
 #include "tuple.hpp"
 #include "unevaluated.hpp"
@@ -93,7 +98,9 @@ public:
   constexpr static auto signed_mode = Signed_Mode;
 
   //! \brief Equals the length in bytes of an action request produced by this key
-  constexpr static auto payload_length = sizeof(Index_T) + detail::parameters_size<R(Args...)>::value;
+  //!
+  //! Requests holding variable-length values (such as \ref<varint> varint instances) may be shorter.
+  constexpr static auto payload_length = sizeof(Index_T) + tuple_t::size;
 
   //! \brief Generate a packet ready to be sent
   //!
@@ -111,6 +118,63 @@ public:
   }
 #endif // defined(DOXYGEN)
 
+  //! \brief Serialize an action request straight into contiguous storage
+  //!
+  //! Unlike `operator()`, no intermediate copy of the packet is made: every value is serialized in place. Requests
+  //! holding variable-length values are then compacted in place.
+  //!
+  //! \param dest Beginning of the storage, which must be at least `payload_length` bytes large
+  //! \param args... Values to insert in the payload
+  //! \return the length in bytes of the request
+  std::size_t encode_into(byte_t *dest, const Args &...args) const {
+    using packet_t = tuple<Endianess, Signed_Mode, Index_T, detail::remove_cv_ref_t<Args>...>;
+
+    encode_into_impl(dest, detail::make_index_sequence<sizeof...(Args)>{}, args...);
+    return detail::has_variable_length<packet_t>::value ? detail::wire_format<packet_t>::compact(dest, dest)
+                                                        : payload_length;
+  }
+
+#if __cplusplus >= 201703L
+  //! \brief (C++17) Serialize an action request in a constant expression
+  //!
+  //! Only integers and arrays of integers can be serialized this way.
+  //!
+  //! \param args... Values to insert in the payload
+  //! \return a `std::array` instance holding the whole packet
+  constexpr std::array<byte_t, payload_length> prebuild(const Args &...args) const {
+    std::array<byte_t, payload_length> retval{};
+    auto *ptr = detail::constexpr_write_as<Endianess, Signed_Mode>(Index, retval.data());
+    ((ptr = detail::constexpr_write_as<Endianess, Signed_Mode>(args, ptr)), ...);
+
+    return retval;
+  }
+#endif // __cplusplus >= 201703L
+
+  //! \brief Serialize an action request and output it through a byte putter
+  //!
+  //! Unlike `operator()`, no intermediate copy of the packet is made: the values are serialized one at a time (one
+  //! element at a time for arrays) and output right away.
+  //!
+  //! \param dest Byte putter
+  //! \param args... Values to insert in the payload
+  template<typename Dest, UPD_REQUIREMENT(output_invocable, Dest)>
+  void write(Dest &&dest, const Args &...args) const {
+    using discard = int[];
+    detail::write_value<Endianess, Signed_Mode>(Index, dest);
+    (void)discard{0, (detail::write_value<Endianess, Signed_Mode>(args, dest), 0)...};
+  }
+
+  //! \brief Serialize an action request and output it through an output iterator
+  //!
+  //! If `it` designates contiguous storage, the request is serialized in place with `encode_into()`.
+  //!
+  //! \param it Output iterator
+  //! \param args... Values to insert in the payload
+  template<typename It, UPD_REQUIREMENT(output_byte_iterator, It)>
+  void write(It it, const Args &...args) const {
+    write_iterator(it, detail::is_contiguous_byte_iterator<It>{}, args...);
+  }
+
   using detail::immediate_reader<key<Index_T, Index, R(Args...), Endianess, Signed_Mode>, return_t>::read_from;
 
   //! \brief Unserialize a value from a packet sent by a callee device in response to a packet generated by this key
@@ -120,9 +184,8 @@ public:
   //! \return the unserialized value
   template<typename Src, UPD_REQUIREMENT(input_invocable, Src), UPD_REQUIRE_CLASS(!std::is_void<return_t>::value)>
   return_t read_from(Src &&src) const {
-    tuple<Endianess, Signed_Mode, detail::remove_cv_ref_t<R>> retval;
-    for (auto &byte : retval)
-      byte = UPD_FWD(src)();
+    tuple<Endianess, Signed_Mode, detail::remove_cv_ref_t<R>> retval{uninitialized};
+    detail::wire_format<decltype(retval)>::load(src, retval.begin());
 
     return retval.template get<0>();
   }
@@ -130,6 +193,17 @@ public:
   template<typename Src, UPD_REQUIREMENT(input_invocable, Src), UPD_REQUIRE_CLASS(std::is_void<return_t>::value)>
   void read_from(Src &&) const {}
 
+  //! \brief Unserialize a value from a packet held in contiguous storage, without going through a byte getter
+  //! \param src Beginning of the packet
+  //! \return the unserialized value
+  template<typename T = return_t, UPD_REQUIRE(!std::is_void<T>::value)>
+  return_t read_from_contiguous(const byte_t *src) const {
+    return tuple_view<const byte_t *, Endianess, Signed_Mode, return_t>{src}.template get<0>();
+  }
+
+  template<typename T = return_t, UPD_REQUIRE(std::is_void<T>::value)>
+  void read_from_contiguous(const byte_t *) const {}
+
   UPD_SFINAE_FAILURE_MEMBER(read_from, UPD_ERROR_NOT_INPUT(src))
 
   //! \brief Plan an action to perform when a packet resulting from the execution of the action is received
@@ -159,9 +233,45 @@ public:
 #endif // __cplusplus >= 201703L
 
   UPD_SFINAE_FAILURE_MEMBER(with_hook, UPD_ERROR_NOT_INVOCABLE(F))
+
+private:
+  //! \brief Bind a view to the storage and serialize every value of the request into it
+  template<std::size_t... Is>
+  void encode_into_impl(byte_t *dest, detail::index_sequence<Is...>, const Args &...args) const {
+    using discard = int[];
+    tuple_view<byte_t *, Endianess, Signed_Mode, Index_T, detail::remove_cv_ref_t<Args>...> view{dest};
+
+    view.template set<0>(Index);
+    (void)discard{0, (view.template set<Is + 1>(args), 0)...};
+  }
+
+  template<typename It>
+  void write_iterator(It it, std::true_type, const Args &...args) const {
+    encode_into(detail::address_of(it), args...);
+  }
+  template<typename It>
+  void write_iterator(It it, std::false_type, const Args &...args) const {
+    write([&](byte_t byte) { *it++ = byte; }, args...);
+  }
 };
 
 template<typename Index_T, Index_T Index, endianess Endianess, signed_mode Signed_Mode>
 class key<Index_T, Index, detail::no_signature, Endianess, Signed_Mode> {};
 
+#if __cplusplus >= 201703L
+//! \brief (C++17) Serialize an action request in a constant expression
+//!
+//! The resulting packet can be stored in read-only memory and sent as is, with no encoding cost, e.g.
+//! `constexpr auto packet = upd::prebuild(keyring.get<f>(), 42, 7);`.
+//!
+//! \param k Key of the requested action
+//! \param args... Values to insert in the payload
+//! \return a `std::array` instance holding the whole packet
+//! \related key
+template<typename Key, typename... Args, UPD_REQUIREMENT(key, Key)>
+constexpr std::array<byte_t, Key::payload_length> prebuild(const Key &k, const Args &...args) {
+  return k.prebuild(args...);
+}
+#endif // __cplusplus >= 201703L
+
 } // namespace upd
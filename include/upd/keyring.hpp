@@ -7,6 +7,7 @@
 #include "upd/detail/type_traits/remove_cv_ref.hpp"
 #include <type_traits>
 
+#include "detail/type_traits/input_tuple.hpp"
 #include "detail/type_traits/signature.hpp"
 #include "detail/type_traits/smallest.hpp"
 #include "detail/type_traits/typelist.hpp"
@@ -46,7 +47,7 @@ public:
   using flist_t = upd::flist_t<unevaluated<Fs, Functions>...>;
 
   //! \brief Typelist containing the signatures of the callbacks
-  using signatures_t = typelist_t<detail::signature_t<Fs>...>;
+  using signatures_t = typelist_t<detail::message_signature_t<Fs>...>;
 
   //! \brief Type of the index prepended to the payload when sending a packet to the callee
   using index_t = detail::smallest_unsigned_t<sizeof...(Fs)>;
@@ -56,7 +57,7 @@ public:
   template<typename H>
   using key_t = key<index_t,
                     detail::find<flist_t, H>::value,
-                    typename std::remove_pointer<typename H::type>::type,
+                    detail::message_signature_t<typename std::remove_pointer<typename H::type>::type>,
                     Endianess,
                     Signed_Mode>;
 
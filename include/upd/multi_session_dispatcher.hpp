@@ -0,0 +1,203 @@
+//! \file
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+#include "buffered_dispatcher.hpp"
+#include "dispatcher.hpp"
+#include "policy.hpp"
+#include "type.hpp"
+#include "upd.hpp"
+
+#include "detail/static_error.hpp"
+#include "detail/type_traits/require.hpp"
+#include "detail/type_traits/smallest.hpp"
+#include "detail/type_traits/typelist.hpp"
+
+namespace upd {
+
+//! \brief Dispatcher serving many sessions with a single action table and a pool of input buffers
+//!
+//! Every session (e.g. a network connection) only needs a \ref<multi_session_dispatcher::session> session instance,
+//! which is a compact parser state: how many bytes of the current packet have been received and which pooled buffer
+//! holds them. The actions are stored once and shared by every session.
+//!
+//! A buffer from the pool is only borrowed while a packet is split across several put() calls. When put() is given
+//! complete packets, they are dispatched directly from the given byte sequence without borrowing any buffer. The
+//! results are written to a byte putter as soon as they are available, so sessions do not need any output buffer.
+//!
+//! \tparam Dispatcher Underlying dispatcher type (e.g. \ref<dispatcher> dispatcher or \ref<static_dispatcher>
+//! static_dispatcher)
+//! \tparam Pool_Size Number of input buffers in the pool, which is the greatest number of sessions which can have a
+//! packet in flight at the same time
+template<typename Dispatcher, std::size_t Pool_Size>
+class multi_session_dispatcher {
+  using keyring_t = typename Dispatcher::keyring_t;
+  using index_t = typename Dispatcher::index_t;
+
+public:
+  //! \brief Size in bytes of each buffer in the pool
+  constexpr static auto buffer_size = detail::needed_input_buffer_size<keyring_t>::value;
+
+  //! \brief Number of buffers in the pool
+  constexpr static auto pool_size = Pool_Size;
+
+private:
+  using count_t = detail::smallest_unsigned_t<buffer_size>;
+  using slot_t = detail::smallest_unsigned_t<Pool_Size>;
+
+  constexpr static auto obuf_size =
+      detail::max_p<detail::needed_output_buffer_size<keyring_t>, std::integral_constant<std::size_t, 1>>::value;
+
+public:
+  //! \brief Parser state of a session
+  //!
+  //! Instances are default-constructed and must be kept by the user for as long as the session lasts. Before an
+  //! instance is destroyed, close() must be called on it if a packet may be in flight, so that its buffer is returned
+  //! to the pool.
+  class session {
+    friend multi_session_dispatcher;
+
+  public:
+    //! \brief Indicates whether a packet has been partially received
+    bool is_loading() const { return m_received != 0; }
+
+  private:
+    count_t m_received = 0;
+    slot_t m_slot = Pool_Size;
+  };
+
+  //! \brief Initialize the underlying dispatcher
+  //!
+  //! \tparam Keyring Keyring which holds the actions to be managed by the dispatcher
+  //! \tparam Action_Features Features of the actions managed by the dispatcher
+  template<typename Keyring, action_features Action_Features>
+  explicit multi_session_dispatcher(Keyring, action_features_h<Action_Features>) : multi_session_dispatcher{} {}
+
+  //! \copybrief multi_session_dispatcher::multi_session_dispatcher
+  multi_session_dispatcher() : m_free_count{Pool_Size} {
+    for (std::size_t i = 0; i < Pool_Size; ++i)
+      m_free_slots[i] = static_cast<slot_t>(i);
+  }
+
+  //! \brief Put a sequence of bytes received by a session
+  //!
+  //! Every packet completed by the byte sequence is resolved and its result is written to `dest`. If a packet is left
+  //! incomplete, a buffer is borrowed from the pool to hold it until the next call. If no buffer is available, the
+  //! function returns early and the remaining bytes must be put again later on.
+  //!
+  //! \param s State of the session which received the bytes
+  //! \param bytes Beginning of the byte sequence
+  //! \param size Number of bytes in the sequence
+  //! \param dest Byte putter receiving the results
+  //! \return a \ref<put_result> put_result instance holding how many bytes were consumed and how many packets were
+  //! resolved or dropped
+  template<typename Dest, UPD_REQUIREMENT(output_invocable, Dest)>
+  put_result put(session &s, const byte_t *bytes, std::size_t size, Dest &&dest) {
+    put_result result{0, 0, 0};
+
+    while (result.consumed < size) {
+      const auto *input = bytes + result.consumed;
+      auto remaining = size - result.consumed;
+
+      if (s.m_received == 0) {
+        if (remaining >= sizeof(index_t)) {
+          const auto *payload = input;
+          auto index = m_dispatcher.get_index([&]() { return *payload++; });
+
+          if (index >= Dispatcher::size) {
+            result.consumed += sizeof(index_t);
+            ++result.dropped;
+            continue;
+          }
+
+          auto packet_size = sizeof(index_t) + m_dispatcher.input_length(index, payload, remaining - sizeof(index_t));
+          if (remaining >= packet_size) {
+            resolve(index, payload, dest);
+            result.consumed += packet_size;
+            ++result.resolved;
+            continue;
+          }
+        }
+
+        if (m_free_count == 0)
+          return result;
+        s.m_slot = m_free_slots[--m_free_count];
+      }
+
+      auto *buf = m_pool[s.m_slot];
+      auto expected = s.m_received < sizeof(index_t) ? sizeof(index_t) : packet_size(buf, s.m_received);
+      auto count = std::min(expected - s.m_received, remaining);
+      std::copy(input, input + count, buf + s.m_received);
+      s.m_received = static_cast<count_t>(s.m_received + count);
+      result.consumed += count;
+
+      if (s.m_received < sizeof(index_t))
+        continue;
+
+      const auto *payload = static_cast<const byte_t *>(buf);
+      auto index = m_dispatcher.get_index([&]() { return *payload++; });
+      if (index >= Dispatcher::size) {
+        close(s);
+        ++result.dropped;
+      } else if (s.m_received == packet_size(buf, s.m_received)) {
+        resolve(index, payload, dest);
+        close(s);
+        ++result.resolved;
+      }
+    }
+
+    return result;
+  }
+
+  UPD_SFINAE_FAILURE_MEMBER(put, UPD_ERROR_NOT_OUTPUT(dest))
+
+  //! \brief Discard the packet being received by a session and return its buffer to the pool
+  //! \param s State of the session
+  void close(session &s) {
+    if (s.m_slot != Pool_Size)
+      m_free_slots[m_free_count++] = s.m_slot;
+
+    s.m_received = 0;
+    s.m_slot = Pool_Size;
+  }
+
+  //! \brief Get the number of buffers which are not currently borrowed by a session
+  std::size_t available_buffers() const { return m_free_count; }
+
+  //! \copydoc dispatcher::replace(F&&)
+  template<index_t Index, typename F>
+  void replace(F &&ftor) {
+    m_dispatcher.template replace<Index>(UPD_FWD(ftor));
+  }
+
+private:
+  //! \brief Size of the packet whose index is at the beginning of `buf`
+  //!
+  //! If the first `received` bytes of `buf` do not hold the whole packet, a lower bound of its size greater than
+  //! `received` is returned instead.
+  std::size_t packet_size(const byte_t *buf, std::size_t received) const {
+    auto index = m_dispatcher.get_index([&]() { return *buf++; });
+    return sizeof(index_t) +
+           (index < Dispatcher::size ? m_dispatcher.input_length(index, buf, received - sizeof(index_t)) : 0);
+  }
+
+  //! \brief Invoke an action and write its result to `dest`
+  template<typename Dest>
+  void resolve(index_t index, const byte_t *payload, Dest &dest) {
+    auto written = m_dispatcher.call(index, payload, m_obuf);
+    for (std::size_t i = 0; i < written; ++i)
+      dest(m_obuf[i]);
+  }
+
+  Dispatcher m_dispatcher;
+  std::size_t m_free_count;
+  slot_t m_free_slots[Pool_Size];
+  byte_t m_pool[Pool_Size][buffer_size];
+  byte_t m_obuf[obuf_size];
+};
+
+} // namespace upd
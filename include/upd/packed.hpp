@@ -0,0 +1,234 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "detail/type_traits/index_sequence.hpp"
+#include "detail/type_traits/require.hpp"
+#include "detail/type_traits/smallest.hpp"
+#include "detail/type_traits/typelist.hpp"
+#include "type.hpp"
+#include "typelist.hpp"
+
+namespace upd {
+
+//! \brief Field of a \ref<packed> packed instance holding a value of type `T` in `N` bits
+//!
+//! `T` may be an integer or an enumeration type. Signed values are stored in two's complement and sign-extended when
+//! read back. Values which do not fit in `N` bits are truncated to their `N` least significant bits.
+//!
+//! \tparam N Width in bits of the field
+//! \tparam T Type of the value (the smallest unsigned integer type with at least `N` bits by default)
+template<std::size_t N, typename T = detail::smallest_unsigned_t<(N > 0 && N <= 64) ? 1ull << (N - 1) : 0>>
+struct bits {
+  static_assert(std::is_integral<T>::value || std::is_enum<T>::value,
+                "Bit fields must hold an integer or an enumeration type");
+  static_assert(N > 0 && N <= sizeof(T) * 8, "The width of a bit field must be between 1 and the width of its type");
+
+  //! \brief Type of the value
+  using value_type = T;
+
+  //! \brief Width in bits of the field
+  constexpr static std::size_t width = N;
+};
+
+template<std::size_t N, typename T>
+constexpr std::size_t bits<N, T>::width;
+
+namespace detail {
+
+//! \name
+//! \brief Width and value type of a field declared as `T` in a \ref<packed> packed instance
+//!
+//! Booleans take a single bit, any other field must be declared as a \ref<bits> bits instance.
+//! @{
+
+template<typename T>
+struct bit_field {
+  static_assert(std::is_same<T, bool>::value, "Packed fields must be either booleans or `upd::bits` instances");
+
+  using value_type = bool;
+  constexpr static std::size_t width = 1;
+};
+template<std::size_t N, typename T>
+struct bit_field<bits<N, T>> {
+  using value_type = T;
+  constexpr static std::size_t width = N;
+};
+
+//! @}
+
+//! \brief Mask of the `Width` least significant bits
+template<std::size_t Width>
+constexpr unsigned long long low_bits_mask() {
+  return Width >= 64 ? ~0ull : (1ull << Width) - 1;
+}
+
+//! \brief Extract `Width` bits starting from the bit `Offset` of a byte sequence
+//!
+//! Bits are numbered from the least significant bit of the first byte.
+template<std::size_t Offset, std::size_t Width>
+unsigned long long read_bits(const byte_t *src) {
+  constexpr std::size_t first = Offset / 8, last = (Offset + Width - 1) / 8, shift = Offset % 8;
+
+  unsigned long long value = src[first] >> shift;
+  for (std::size_t i = first + 1; i <= last; i++)
+    value |= static_cast<unsigned long long>(src[i]) << (8 * (i - first) - shift);
+
+  return value & low_bits_mask<Width>();
+}
+
+//! \brief Overwrite `Width` bits starting from the bit `Offset` of a byte sequence
+//!
+//! The other bits of the byte sequence are left untouched.
+template<std::size_t Offset, std::size_t Width>
+void write_bits(unsigned long long value, byte_t *dest) {
+  constexpr std::size_t first = Offset / 8, last = (Offset + Width - 1) / 8, shift = Offset % 8;
+  constexpr auto mask = low_bits_mask<Width>();
+
+  value &= mask;
+  dest[first] = static_cast<byte_t>((dest[first] & ~(mask << shift)) | value << shift);
+  for (std::size_t i = first + 1; i <= last; i++) {
+    auto pos = 8 * (i - first) - shift;
+    dest[i] = static_cast<byte_t>((dest[i] & ~(mask >> pos)) | value >> pos);
+  }
+}
+
+//! \name
+//! \brief Convert a value into the bits stored in a \ref<packed> packed instance
+//! @{
+
+template<typename T, require<std::is_integral<T>::value> = 0>
+unsigned long long to_bits(T value) {
+  return static_cast<unsigned long long>(value);
+}
+template<typename T, require<std::is_enum<T>::value> = 0>
+unsigned long long to_bits(T value) {
+  return to_bits(static_cast<typename std::underlying_type<T>::type>(value));
+}
+
+//! @}
+
+//! \name
+//! \brief Inverse of `to_bits` for a field of width `Width`
+//! @{
+
+template<typename T, std::size_t Width, require<std::is_unsigned<T>::value> = 0>
+T from_bits(unsigned long long bits) {
+  return static_cast<T>(bits);
+}
+template<typename T, std::size_t Width, require<std::is_integral<T>::value && std::is_signed<T>::value> = 0>
+T from_bits(unsigned long long bits) {
+  auto magnitude = static_cast<T>(~bits & low_bits_mask<Width>());
+  return bits >> (Width - 1) & 1 ? static_cast<T>(-magnitude - 1) : static_cast<T>(bits);
+}
+template<typename T, std::size_t Width, require<std::is_enum<T>::value> = 0>
+T from_bits(unsigned long long bits) {
+  return static_cast<T>(from_bits<typename std::underlying_type<T>::type, Width>(bits));
+}
+
+//! @}
+
+} // namespace detail
+
+//! \brief Values stored next to each other at the bit level
+//!
+//! The fields of a packed instance are either `bool` (taking one bit) or \ref<bits> bits instances. They are laid out
+//! back to back from the least significant bit of the first byte, and the whole instance occupies as few bytes as its
+//! fields need: a `packed` instance of sixteen booleans takes two bytes. The object representation of a packed instance
+//! is its serialized representation, so the serialization parameters have no effect on it.
+//!
+//! Each field is accessed through `get()` and `set()`, which extract and insert its bits with shifts and masks computed
+//! at compile time.
+//!
+//! \tparam Ts Types of the fields
+template<typename... Ts>
+class packed {
+  static_assert(sizeof...(Ts) > 0, "Packed instances must hold at least one field");
+
+  using widths_t = typelist_t<std::integral_constant<std::size_t, detail::bit_field<Ts>::width>...>;
+
+  template<std::size_t I>
+  using offset_t = detail::sum<detail::clip<widths_t, 0, I>>;
+
+  template<std::size_t I>
+  using width_t = detail::at<widths_t, I>;
+
+public:
+  //! \brief Type of the value held by the Ith field
+  template<std::size_t I>
+  using field_t = typename detail::bit_field<detail::at<typelist_t<Ts...>, I>>::value_type;
+
+  //! \brief Number of bits taken by the fields
+  constexpr static std::size_t bit_count = detail::sum<widths_t>::value;
+
+  //! \brief Size in bytes of the instance
+  constexpr static std::size_t size = (bit_count + 7) / 8;
+
+  //! \brief Clear every field
+  constexpr packed() : m_bytes{} {}
+
+  //! \brief Initialize every field
+  packed(const typename detail::bit_field<Ts>::value_type &...values) : m_bytes{} {
+    set_all(detail::make_index_sequence<sizeof...(Ts)>{}, values...);
+  }
+
+  //! \brief Get the value of the Ith field
+  template<std::size_t I>
+  field_t<I> get() const {
+    return detail::from_bits<field_t<I>, width_t<I>::value>(
+        detail::read_bits<offset_t<I>::value, width_t<I>::value>(m_bytes));
+  }
+
+  //! \brief Set the value of the Ith field
+  template<std::size_t I>
+  void set(const field_t<I> &value) {
+    detail::write_bits<offset_t<I>::value, width_t<I>::value>(detail::to_bits(value), m_bytes);
+  }
+
+  //! \brief Access the bytes holding the fields
+  byte_t *data() { return m_bytes; }
+
+  //! \copydoc data
+  const byte_t *data() const { return m_bytes; }
+
+private:
+  template<std::size_t... Is>
+  void set_all(detail::index_sequence<Is...>, const typename detail::bit_field<Ts>::value_type &...values) {
+    using discard = int[];
+    (void)discard{0, (set<Is>(values), 0)...};
+  }
+
+  byte_t m_bytes[size];
+};
+
+template<typename... Ts>
+constexpr std::size_t packed<Ts...>::bit_count;
+
+template<typename... Ts>
+constexpr std::size_t packed<Ts...>::size;
+
+namespace detail {
+
+//! \name
+//! \brief Make a \ref<packed> packed instance of `N` booleans
+//! @{
+
+template<std::size_t N, typename... Ts>
+struct make_flags : make_flags<N - 1, bool, Ts...> {};
+template<typename... Ts>
+struct make_flags<0, Ts...> {
+  using type = packed<Ts...>;
+};
+
+//! @}
+
+} // namespace detail
+
+//! \brief Alias for a \ref<packed> packed instance of `N` booleans
+template<std::size_t N>
+using flags = typename detail::make_flags<N>::type;
+
+} // namespace upd
@@ -0,0 +1,146 @@
+//! \file
+
+#pragma once
+
+#include <type_traits>
+
+#include "detail/type_traits/smallest.hpp"
+#include "upd.hpp"
+
+namespace upd {
+namespace detail {
+
+//! \name
+//! \brief Integer type of the values of `T` (its underlying type if `T` is an enumeration type)
+//! @{
+
+template<typename T, bool = std::is_enum<T>::value>
+struct integer_of {
+  using type = T;
+};
+template<typename T>
+struct integer_of<T, true> {
+  using type = typename std::underlying_type<T>::type;
+};
+
+template<typename T>
+using integer_of_t = typename integer_of<T>::type;
+
+//! @}
+
+//! \brief Convert a value into its integer type
+template<typename T>
+constexpr integer_of_t<T> to_integer(T value) {
+  return static_cast<integer_of_t<T>>(value);
+}
+
+//! \brief Number of values between `min` and `max`, minus one
+template<typename T>
+constexpr unsigned long long range_span(T min, T max) {
+  return static_cast<unsigned long long>(to_integer(max)) - static_cast<unsigned long long>(to_integer(min));
+}
+
+} // namespace detail
+
+//! \brief Integer or enumerator known to lie in the range `[Min, Max]`
+//!
+//! Ranged values are serialized as their offset from `Min`, with the smallest unsigned integer type able to hold
+//! `Max - Min`: a `ranged<int, 0, 1000>` is serialized in two bytes and a `ranged<int, 1000, 1100>` in a single one.
+//! Only the endianess serialization parameter applies to ranged values.
+//!
+//! Values are not checked when they are serialized, whether they are sent in a request or in a response: a value out of
+//! range is sent as its offset truncated to the serialized width, so that packets always have their expected length.
+//! `in_range()` tells whether a value is valid, before sending it or after receiving it.
+//!
+//! \tparam T Integer or enumeration type of the value
+//! \tparam Min Smallest value
+//! \tparam Max Greatest value
+template<typename T, T Min, T Max>
+class ranged {
+  static_assert((std::is_integral<T>::value && !std::is_same<T, bool>::value) || std::is_enum<T>::value,
+                "Ranged values must hold an integer or an enumeration type");
+  static_assert(!(detail::to_integer(Max) < detail::to_integer(Min)), "`Min` must not be greater than `Max`");
+
+public:
+  //! \brief Type of the value
+  using value_type = T;
+
+  //! \brief Type of the serialized representation
+  using representation_t = detail::smallest_unsigned_t<detail::range_span(Min, Max)>;
+
+  //! \brief Smallest value
+  constexpr static T min = Min;
+
+  //! \brief Greatest value
+  constexpr static T max = Max;
+
+  //! \brief Hold the smallest value
+  constexpr ranged() : m_value{Min} {}
+
+  //! \brief Hold a value
+  constexpr ranged(T value) : m_value{value} {}
+
+  //! \brief Get the value
+  constexpr T value() const { return m_value; }
+
+  //! \copydoc value
+  constexpr operator T() const { return m_value; }
+
+  //! \brief Check if the value lies in `[Min, Max]`
+  constexpr bool in_range() const {
+    return !(detail::to_integer(m_value) < detail::to_integer(Min)) &&
+           !(detail::to_integer(Max) < detail::to_integer(m_value));
+  }
+
+  //! \brief Get the offset of the value from `Min`
+  constexpr representation_t representation() const {
+    return static_cast<representation_t>(detail::range_span(Min, m_value));
+  }
+
+  //! \brief Make a ranged value from its offset from `Min`
+  constexpr static ranged from_representation(representation_t offset) {
+    return static_cast<T>(
+        static_cast<detail::integer_of_t<T>>(static_cast<unsigned long long>(detail::to_integer(Min)) + offset));
+  }
+
+private:
+  T m_value;
+};
+
+template<typename T, T Min, T Max>
+constexpr T ranged<T, Min, Max>::min;
+
+template<typename T, T Min, T Max>
+constexpr T ranged<T, Min, Max>::max;
+
+namespace detail {
+
+//! \brief Template instance of `ranged` serializing the values of an enumeration type with a range
+template<typename E>
+using enum_ranged_t = ranged<E, upd_enum_range<E>::min, upd_enum_range<E>::max>;
+
+//! \name
+//! \brief Conversions between values of type `T` and their integer representation
+//! @{
+
+template<typename T, typename = void>
+struct integer_backing {
+  using representation_t = typename T::representation_t;
+
+  static representation_t encode(const T &value) { return value.representation(); }
+  static T decode(representation_t representation) { return T::from_representation(representation); }
+};
+template<typename E>
+struct integer_backing<E, typename std::enable_if<std::is_enum<E>::value>::type> {
+  using representation_t = typename enum_ranged_t<E>::representation_t;
+
+  static representation_t encode(E value) { return enum_ranged_t<E>{value}.representation(); }
+  static E decode(representation_t representation) {
+    return enum_ranged_t<E>::from_representation(representation).value();
+  }
+};
+
+//! @}
+
+} // namespace detail
+} // namespace upd
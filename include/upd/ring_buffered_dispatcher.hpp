@@ -0,0 +1,198 @@
+//! \file
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+
+#include "buffered_dispatcher.hpp"
+#include "dispatcher.hpp"
+#include "policy.hpp"
+#include "type.hpp"
+#include "upd.hpp"
+
+#include "detail/io/immediate_writer.hpp"
+#include "detail/static_error.hpp"
+#include "detail/type_traits/require.hpp"
+
+#ifndef UPD_CACHE_LINE_SIZE
+//! \brief Alignment in bytes separating the data written by the producer from the data written by the consumer
+//!
+//! The default value is the cache line size of most desktop and server processors. It can be lowered on targets
+//! without data cache to save memory.
+#define UPD_CACHE_LINE_SIZE 64
+#endif // UPD_CACHE_LINE_SIZE
+
+namespace upd {
+
+//! \brief Dispatcher receiving its input through a lock-free single-producer / single-consumer ring buffer
+//!
+//! This class splits the work of a buffered dispatcher between two execution contexts:
+//!
+//!   - The producer (e.g. an interrupt handler or a reader thread) only copies the received bytes into the ring buffer
+//!   by calling put(). This is bounded and short, and no callback is ever invoked from that context.
+//!   - The consumer (e.g. the main loop or a worker thread) calls poll(), which takes the bytes out of the ring
+//!   buffer, frames and decodes the packets then invokes the corresponding actions.
+//!
+//! put() must only be called from the producer context while every other member function must only be called from the
+//! consumer context. The two contexts synchronize through atomic counters, so no lock is needed. The counter written by
+//! the producer, the counter written by the consumer and the ring buffer lie on separate cache lines (see
+//! `UPD_CACHE_LINE_SIZE`), so that one context writing its counter does not evict the cache line read by the other.
+//!
+//! \tparam Dispatcher Underlying dispatcher type
+//! \tparam Capacity Size in bytes of the ring buffer (must be a power of two)
+template<typename Dispatcher, std::size_t Capacity>
+class ring_buffered_dispatcher : public detail::immediate_writer<ring_buffered_dispatcher<Dispatcher, Capacity>> {
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "`Capacity` must be a power of two");
+
+  using this_t = ring_buffered_dispatcher<Dispatcher, Capacity>;
+
+public:
+  //! \copydoc dispatcher::index_t
+  using index_t = typename Dispatcher::index_t;
+
+  //! \copydoc dispatcher::keyring_t
+  using keyring_t = typename Dispatcher::keyring_t;
+
+  //! \brief Size in bytes of the ring buffer
+  constexpr static auto capacity = Capacity;
+
+  //! \brief Initialize the underlying dispatcher
+  //!
+  //! \tparam Keyring Keyring which holds the actions to be managed by the dispatcher
+  //! \tparam Action_Features Features of the actions managed by the dispatcher
+  template<typename Keyring, action_features Action_Features>
+  explicit ring_buffered_dispatcher(Keyring, action_features_h<Action_Features>) : ring_buffered_dispatcher{} {}
+
+  //! \copybrief ring_buffered_dispatcher::ring_buffered_dispatcher
+  ring_buffered_dispatcher() : m_head{0}, m_tail{0} {}
+
+  ring_buffered_dispatcher(const ring_buffered_dispatcher &) = delete;
+  ring_buffered_dispatcher &operator=(const ring_buffered_dispatcher &) = delete;
+
+  //! \brief (Producer) Copy a sequence of bytes into the ring buffer
+  //!
+  //! If the ring buffer does not have enough free space, only the leading bytes which fit are copied.
+  //!
+  //! \param bytes Beginning of the byte sequence
+  //! \param size Number of bytes in the sequence
+  //! \return the number of copied bytes
+  std::size_t put(const byte_t *bytes, std::size_t size) {
+    auto head = m_head.load(std::memory_order_relaxed);
+    auto tail = m_tail.load(std::memory_order_acquire);
+    auto count = std::min(size, Capacity - (head - tail));
+
+    auto offset = head & (Capacity - 1);
+    auto first_chunk = std::min(count, Capacity - offset);
+    std::copy(bytes, bytes + first_chunk, m_ring + offset);
+    std::copy(bytes + first_chunk, bytes + count, m_ring);
+
+    m_head.store(head + count, std::memory_order_release);
+    return count;
+  }
+
+  //! \brief (Producer) Copy one byte into the ring buffer
+  //! \param byte Byte to copy
+  //! \return `false` if and only if the ring buffer is full, in which case the byte is discarded
+  bool put(byte_t byte) { return put(&byte, 1) == 1; }
+
+  //! \brief (Consumer) Process the bytes stored in the ring buffer
+  //!
+  //! The bytes are taken out of the ring buffer and the completed packets are resolved, until the ring buffer is empty
+  //! or a resolved packet leaves the output buffer loaded. In the latter case, the output buffer must be unloaded
+  //! before the next call, otherwise no byte is processed.
+  //!
+  //! \return a \ref<put_result> put_result instance holding how many bytes were taken out of the ring buffer and how
+  //! many packets were resolved or dropped
+  put_result poll() {
+    put_result result{0, 0, 0};
+
+    while (!m_dispatcher.is_loaded()) {
+      auto head = m_head.load(std::memory_order_acquire);
+      auto tail = m_tail.load(std::memory_order_relaxed);
+      if (head == tail)
+        break;
+
+      auto offset = tail & (Capacity - 1);
+      auto chunk = m_dispatcher.put(m_ring + offset, std::min(head - tail, Capacity - offset));
+      m_tail.store(tail + chunk.consumed, std::memory_order_release);
+
+      result.consumed += chunk.consumed;
+      result.resolved += chunk.resolved;
+      result.dropped += chunk.dropped;
+    }
+
+    return result;
+  }
+
+  //! \brief (Consumer) Process the bytes stored in the ring buffer and write every result to `dest`
+  //!
+  //! Unlike poll(), this function only returns once the ring buffer is empty.
+  //!
+  //! \param dest Byte putter
+  //! \return the accumulated \ref<put_result> put_result instance
+  template<typename Dest, UPD_REQUIREMENT(output_invocable, Dest)>
+  put_result poll(Dest &&dest) {
+    put_result result{0, 0, 0};
+
+    for (;;) {
+      write_to(dest);
+
+      auto chunk = poll();
+      if (chunk.consumed == 0)
+        break;
+
+      result.consumed += chunk.consumed;
+      result.resolved += chunk.resolved;
+      result.dropped += chunk.dropped;
+    }
+
+    return result;
+  }
+
+  UPD_SFINAE_FAILURE_MEMBER(poll, UPD_ERROR_NOT_OUTPUT(dest))
+
+  //! \copydoc buffered_dispatcher::is_loaded
+  bool is_loaded() const { return m_dispatcher.is_loaded(); }
+
+  //! \copydoc buffered_dispatcher::get
+  byte_t get() { return m_dispatcher.get(); }
+
+  using detail::immediate_writer<this_t>::write_to;
+
+  //! \copydoc buffered_dispatcher::write_to
+  template<typename Dest, UPD_REQUIREMENT(output_invocable, Dest)>
+  void write_to(Dest &&dest) {
+    while (is_loaded())
+      dest(get());
+  }
+
+  UPD_SFINAE_FAILURE_MEMBER(write_to, UPD_ERROR_NOT_OUTPUT(dest))
+
+  //! \copydoc buffered_dispatcher::replace(F&&)
+  template<index_t Index, typename F>
+  void replace(F &&ftor) {
+    m_dispatcher.template replace<Index>(UPD_FWD(ftor));
+  }
+
+private:
+  double_buffered_dispatcher<Dispatcher> m_dispatcher;
+  alignas(std::atomic<std::size_t>) alignas(UPD_CACHE_LINE_SIZE) std::atomic<std::size_t> m_head;
+  alignas(std::atomic<std::size_t>) alignas(UPD_CACHE_LINE_SIZE) std::atomic<std::size_t> m_tail;
+  alignas(UPD_CACHE_LINE_SIZE) byte_t m_ring[Capacity];
+};
+
+#if __cplusplus >= 201703L
+//! \brief (C++17) Make a ring buffered dispatcher
+//! \tparam Capacity Size in bytes of the ring buffer
+//! \related ring_buffered_dispatcher
+template<std::size_t Capacity, typename Keyring, action_features Action_Features>
+ring_buffered_dispatcher<dispatcher<Keyring, Action_Features>, Capacity>
+make_ring_buffered_dispatcher(Keyring, action_features_h<Action_Features>) {
+  return ring_buffered_dispatcher<dispatcher<Keyring, Action_Features>, Capacity>{Keyring{},
+                                                                                 action_features_h<Action_Features>{}};
+}
+#endif // __cplusplus >= 201703L
+
+} // namespace upd
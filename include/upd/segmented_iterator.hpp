@@ -0,0 +1,182 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+#include "detail/type_traits/require.hpp"
+#include "type.hpp"
+
+namespace upd {
+
+//! \brief Random access iterator to a byte sequence stored in two contiguous segments
+//!
+//! Such a byte sequence typically is the content of a ring buffer wrapping around its end: the first segment lies at
+//! the end of the ring buffer storage and the second one at its beginning. \ref<tuple_view> tuple_view instances bound
+//! through a segmented iterator read and write their values in place, the same way as with a plain pointer, except for
+//! the single value which straddles the boundary between the two segments, if any.
+//!
+//! Only the size of the first segment is needed to walk the sequence: the second segment is entered as soon as the
+//! first one is exhausted.
+//!
+//! \tparam T Type of the bytes (either `byte_t` or `const byte_t`)
+template<typename T>
+class segmented_iterator {
+  static_assert(std::is_same<typename std::remove_const<T>::type, byte_t>::value,
+                "Segmented iterators can only designate bytes");
+
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = byte_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
+  segmented_iterator() = default;
+
+  //! \brief Designate the beginning of a byte sequence stored in two segments
+  //! \param first Beginning of the first segment
+  //! \param first_size Size in bytes of the first segment
+  //! \param second Beginning of the second segment
+  segmented_iterator(T *first, std::size_t first_size, T *second)
+      : m_first{first}, m_first_size{static_cast<difference_type>(first_size)}, m_second{second}, m_pos{0} {}
+
+  //! \brief Convert an iterator to mutable bytes into an iterator to constant bytes
+  template<typename U, UPD_REQUIRE(std::is_same<U, byte_t>::value && std::is_const<T>::value)>
+  segmented_iterator(const segmented_iterator<U> &other)
+      : m_first{other.m_first}, m_first_size{other.m_first_size}, m_second{other.m_second}, m_pos{other.m_pos} {}
+
+  //! \brief Address of the designated byte
+  T *address() const { return m_pos < m_first_size ? m_first + m_pos : m_second + (m_pos - m_first_size); }
+
+  //! \brief Address of a range of bytes, if it lies in a single segment
+  //! \param offset Position of the range from the designated byte
+  //! \param size Size in bytes of the range
+  //! \return the address of the first byte of the range or `nullptr` if the range straddles both segments
+  T *contiguous_range(std::size_t offset, std::size_t size) const {
+    auto begin = m_pos + static_cast<difference_type>(offset), end = begin + static_cast<difference_type>(size);
+    return begin >= m_first_size || end <= m_first_size ? (*this + static_cast<difference_type>(offset)).address()
+                                                         : nullptr;
+  }
+
+  //! \brief Copy a range of bytes into contiguous storage
+  //! \param offset Position of the range from the designated byte
+  //! \param size Size in bytes of the range
+  //! \param dest Beginning of the storage
+  void copy_to(std::size_t offset, std::size_t size, byte_t *dest) const {
+    auto it = *this + static_cast<difference_type>(offset);
+    auto head = it.m_pos < m_first_size ? static_cast<std::size_t>(m_first_size - it.m_pos) : 0;
+    head = head < size ? head : size;
+
+    std::memcpy(dest, it.address(), head);
+    std::memcpy(dest + head, (it + static_cast<difference_type>(head)).address(), size - head);
+  }
+
+  //! \brief Copy contiguous storage into a range of bytes
+  //! \param offset Position of the range from the designated byte
+  //! \param size Size in bytes of the range
+  //! \param src Beginning of the storage
+  void copy_from(std::size_t offset, std::size_t size, const byte_t *src) const {
+    auto it = *this + static_cast<difference_type>(offset);
+    auto head = it.m_pos < m_first_size ? static_cast<std::size_t>(m_first_size - it.m_pos) : 0;
+    head = head < size ? head : size;
+
+    std::memcpy(it.address(), src, head);
+    std::memcpy((it + static_cast<difference_type>(head)).address(), src + head, size - head);
+  }
+
+  T &operator*() const { return *address(); }
+  T &operator[](difference_type n) const { return *(*this + n); }
+
+  segmented_iterator &operator++() { return *this += 1; }
+  segmented_iterator &operator--() { return *this -= 1; }
+  segmented_iterator operator++(int) {
+    auto retval = *this;
+    ++*this;
+    return retval;
+  }
+  segmented_iterator operator--(int) {
+    auto retval = *this;
+    --*this;
+    return retval;
+  }
+
+  segmented_iterator &operator+=(difference_type n) {
+    m_pos += n;
+    return *this;
+  }
+  segmented_iterator &operator-=(difference_type n) { return *this += -n; }
+
+  friend segmented_iterator operator+(segmented_iterator it, difference_type n) { return it += n; }
+  friend segmented_iterator operator+(difference_type n, segmented_iterator it) { return it += n; }
+  friend segmented_iterator operator-(segmented_iterator it, difference_type n) { return it -= n; }
+  friend difference_type operator-(const segmented_iterator &lhs, const segmented_iterator &rhs) {
+    return lhs.m_pos - rhs.m_pos;
+  }
+
+  friend bool operator==(const segmented_iterator &lhs, const segmented_iterator &rhs) {
+    return lhs.m_pos == rhs.m_pos;
+  }
+  friend bool operator!=(const segmented_iterator &lhs, const segmented_iterator &rhs) {
+    return lhs.m_pos != rhs.m_pos;
+  }
+  friend bool operator<(const segmented_iterator &lhs, const segmented_iterator &rhs) { return lhs.m_pos < rhs.m_pos; }
+  friend bool operator>(const segmented_iterator &lhs, const segmented_iterator &rhs) { return lhs.m_pos > rhs.m_pos; }
+  friend bool operator<=(const segmented_iterator &lhs, const segmented_iterator &rhs) {
+    return lhs.m_pos <= rhs.m_pos;
+  }
+  friend bool operator>=(const segmented_iterator &lhs, const segmented_iterator &rhs) {
+    return lhs.m_pos >= rhs.m_pos;
+  }
+
+private:
+  template<typename>
+  friend class segmented_iterator;
+
+  T *m_first = nullptr;
+  difference_type m_first_size = 0;
+  T *m_second = nullptr;
+  difference_type m_pos = 0;
+};
+
+//! \brief Make an iterator to the beginning of a byte sequence stored in two segments
+//! \param first Beginning of the first segment
+//! \param first_size Size in bytes of the first segment
+//! \param second Beginning of the second segment
+//! \related segmented_iterator
+template<typename T>
+segmented_iterator<T> make_segmented_iterator(T *first, std::size_t first_size, T *second) {
+  return {first, first_size, second};
+}
+
+//! \brief Make an iterator to a byte sequence stored in a ring buffer
+//!
+//! The byte sequence starts at `offset` in the ring buffer storage and wraps around its end if needed.
+//!
+//! \param storage Beginning of the ring buffer storage
+//! \param capacity Size in bytes of the ring buffer storage
+//! \param offset Position of the first byte of the sequence in the storage
+//! \related segmented_iterator
+template<typename T>
+segmented_iterator<T> make_ring_iterator(T *storage, std::size_t capacity, std::size_t offset) {
+  return {storage + offset, capacity - offset, storage};
+}
+
+namespace detail {
+
+//! \name
+//! \brief Check if `T` is a template instance of `segmented_iterator`
+//! @{
+
+template<typename T>
+struct is_segmented_iterator : std::false_type {};
+template<typename T>
+struct is_segmented_iterator<segmented_iterator<T>> : std::true_type {};
+
+//! @}
+
+} // namespace detail
+} // namespace upd
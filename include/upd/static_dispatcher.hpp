@@ -0,0 +1,206 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "action.hpp"
+#include "detail/io/immediate_process.hpp"
+#include "detail/size_table.hpp"
+#include "detail/static_error.hpp"
+#include "detail/type_traits/input_tuple.hpp"
+#include "detail/type_traits/is_keyring.hpp"
+#include "detail/type_traits/require.hpp"
+#include "dispatcher.hpp"
+#include "format.hpp"
+#include "tuple.hpp"
+#include "type.hpp"
+#include "typelist.hpp"
+#include "unevaluated.hpp" // IWYU pragma: keep
+#include "upd.hpp"
+
+// IWYU pragma: no_forward_declare unevaluated
+
+namespace upd {
+namespace detail {
+
+//! \name
+//! \brief Compile-time tables of the functions invoking the callbacks of a keyring
+//!
+//! Each entry invokes a single callback, which is known at compile-time and may therefore be inlined into the entry. A
+//! runtime index is resolved by loading the matching entry and calling it, so dispatching takes the same time whatever
+//! the number of callbacks.
+//! @{
+
+template<endianess, signed_mode, typename>
+struct static_table;
+
+template<endianess Endianess, signed_mode Signed_Mode, typename... Fs, Fs... Ftors>
+struct static_table<Endianess, Signed_Mode, flist_t<unevaluated<Fs, Ftors>...>> {
+  //! \brief Type of the entries
+  using entry_t = std::size_t (*)(const byte_t *, byte_t *);
+
+  //! \brief Invoke `Ftor` on a contiguous payload and write its serialized result to `output`
+  template<typename F, F Ftor>
+  static std::size_t entry(const byte_t *input, byte_t *output) {
+    return detail::call<input_tuple<Endianess, Signed_Mode, decltype(*Ftor)>>(input, output, *Ftor);
+  }
+
+  //! \brief Functions invoking each callback on a contiguous payload
+  constexpr static entry_t entries[] = {&entry<Fs, Ftors>...};
+};
+
+template<endianess Endianess, signed_mode Signed_Mode, typename... Fs, Fs... Ftors>
+constexpr typename static_table<Endianess, Signed_Mode, flist_t<unevaluated<Fs, Ftors>...>>::entry_t
+    static_table<Endianess, Signed_Mode, flist_t<unevaluated<Fs, Ftors>...>>::entries[];
+
+template<endianess, signed_mode, typename, typename Src, typename Dest>
+struct static_stream_table;
+
+template<endianess Endianess, signed_mode Signed_Mode, typename... Fs, Fs... Ftors, typename Src, typename Dest>
+struct static_stream_table<Endianess, Signed_Mode, flist_t<unevaluated<Fs, Ftors>...>, Src, Dest> {
+  //! \brief Type of the entries
+  using entry_t = void (*)(Src &, Dest &);
+
+  //! \brief Invoke `Ftor` on the payload output by `src` and write its serialized result to `dest`
+  template<typename F, F Ftor>
+  static void entry(Src &src, Dest &dest) {
+    detail::call<input_tuple<Endianess, Signed_Mode, decltype(*Ftor)>>(src, dest, *Ftor);
+  }
+
+  //! \brief Functions invoking each callback on a payload output by a byte getter
+  constexpr static entry_t entries[] = {&entry<Fs, Ftors>...};
+};
+
+template<endianess Endianess, signed_mode Signed_Mode, typename... Fs, Fs... Ftors, typename Src, typename Dest>
+constexpr typename static_stream_table<Endianess, Signed_Mode, flist_t<unevaluated<Fs, Ftors>...>, Src, Dest>::entry_t
+    static_stream_table<Endianess, Signed_Mode, flist_t<unevaluated<Fs, Ftors>...>, Src, Dest>::entries[];
+
+//! @}
+
+} // namespace detail
+
+//! \brief Dispatcher whose actions are resolved at compile-time
+//!
+//! Unlike \ref<dispatcher> dispatcher, this class does not store any action: the index received selects an entry of a
+//! table of functions generated at compile-time and stored in program memory, each of them calling a single callback
+//! of the keyring directly. Instances of this class therefore do not occupy any memory and let the compiler inline the
+//! callbacks into the entries, at the cost of not being able to replace them.
+//!
+//! \tparam Keyring Keyring describing the actions to call
+template<typename Keyring>
+class static_dispatcher
+    : public detail::immediate_process<static_dispatcher<Keyring>, typename Keyring::index_t> {
+  static_assert(detail::is_keyring<Keyring>::value, UPD_ERROR_NOT_KEYRING(Keyring));
+
+  using table_t = detail::static_table<Keyring::endianess, Keyring::signed_mode, typename Keyring::flist_t>;
+  template<typename Src, typename Dest>
+  using stream_table_t =
+      detail::static_stream_table<Keyring::endianess, Keyring::signed_mode, typename Keyring::flist_t, Src, Dest>;
+  using size_table_t = detail::keyring_size_table<Keyring>;
+
+public:
+  //! \copydoc keyring::signatures_t
+  using signatures_t = typename Keyring::signatures_t;
+
+  //! \copydoc keyring::index_t
+  using index_t = typename Keyring::index_t;
+
+  //! \brief Keyring describing the actions to call
+  using keyring_t = Keyring;
+
+  //! \copydoc keyring::size
+  constexpr static auto size = Keyring::size;
+
+  //! \copydoc keyring::endianess
+  constexpr static auto endianess = Keyring::endianess;
+
+  //!  \copydoc keyring::signed_mode
+  constexpr static auto signed_mode = Keyring::signed_mode;
+
+  //! \brief Construct the object from the provided keyring
+  constexpr explicit static_dispatcher(Keyring) {}
+
+  //! \copybrief static_dispatcher::static_dispatcher
+  constexpr static_dispatcher() = default;
+
+  using detail::immediate_process<static_dispatcher<Keyring>, index_t>::operator();
+
+  //! \copydoc dispatcher::operator()()
+  template<typename Src, typename Dest, UPD_REQUIREMENT(input_invocable, Src), UPD_REQUIREMENT(output_invocable, Dest)>
+  index_t operator()(Src &&src, Dest &&dest) const {
+    auto index = get_index(src);
+
+    using entries_t =
+        stream_table_t<typename std::remove_reference<Src>::type, typename std::remove_reference<Dest>::type>;
+
+    if (index < size)
+      entries_t::entries[index](src, dest);
+
+    return index;
+  }
+
+  UPD_SFINAE_FAILURE_MEMBER(operator(), UPD_ERROR_NOT_INPUT(src) " OR " UPD_ERROR_NOT_OUTPUT(dest))
+
+  //! \brief Invoke the action with the provided index on a contiguous payload
+  //! \param index Index of the action
+  //! \param input Beginning of the payload (without the index)
+  //! \param output Beginning of the buffer receiving the serialized result
+  //! \return the number of bytes written to `output`
+  //! \warning No bound check is performed.
+  std::size_t call(index_t index, const byte_t *input, byte_t *output) const {
+    return table_t::entries[index](input, output);
+  }
+
+  //! \copydoc dispatcher::dispatch_batch
+  batch_result dispatch_batch(const byte_t *input,
+                              std::size_t input_length,
+                              byte_t *output,
+                              std::size_t output_length,
+                              batch_entry *entries,
+                              std::size_t max_entries) const {
+    return detail::dispatch_batch(*this, input, input_length, output, output_length, entries, max_entries);
+  }
+
+  //! \copydoc dispatcher::get_index
+  template<typename Src, UPD_REQUIREMENT(input_invocable, Src)>
+  index_t get_index(Src &&src) const {
+    tuple<endianess, signed_mode, index_t> index_tuple{uninitialized};
+
+    for (auto &byte : index_tuple)
+      byte = src();
+
+    return get<0>(index_tuple);
+  }
+
+  //! \brief Get the size in bytes of the payload needed to invoke an action
+  //! \param index Index of an action
+  //! \warning No bound check is performed.
+  static std::size_t input_size(index_t index) { return size_table_t::input_sizes[index]; }
+
+  //! \brief Get the size in bytes of the serialized return value of an action
+  //! \param index Index of an action
+  //! \warning No bound check is performed.
+  static std::size_t output_size(index_t index) { return size_table_t::output_sizes[index]; }
+
+  //! \copydoc dispatcher::input_length
+  static std::size_t input_length(index_t index, const byte_t *payload, std::size_t available) {
+    return size_table_t::has_variable_inputs ? size_table_t::input_lengths[index](payload, available)
+                                              : input_size(index);
+  }
+};
+
+#if __cplusplus >= 201703L
+template<typename Keyring>
+static_dispatcher(Keyring) -> static_dispatcher<Keyring>;
+#endif // __cplusplus >= 201703L
+
+//! \brief Make a static dispatcher
+//! \related static_dispatcher
+template<typename Keyring>
+constexpr static_dispatcher<Keyring> make_static_dispatcher(Keyring) {
+  return static_dispatcher<Keyring>{};
+}
+
+} // namespace upd
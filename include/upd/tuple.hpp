@@ -2,26 +2,46 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <tuple>
 #include <type_traits>
 
+#include "array_view.hpp"
+#include "bounded_vector.hpp"
+#include "detail/ieee754.hpp"
 #include "detail/serialization.hpp"
 #include "detail/type_traits/conjunction.hpp"
 #include "detail/type_traits/index_sequence.hpp"
+#include "detail/type_traits/iterator_category.hpp"
+#include "detail/type_traits/remove_cv_ref.hpp"
 #include "detail/type_traits/require.hpp"
 #include "detail/type_traits/signature.hpp"
 #include "detail/type_traits/typelist.hpp"
 #include "format.hpp"
+#include "segmented_iterator.hpp"
 #include "type.hpp"
 #include "typelist.hpp"
 #include "upd.hpp"
+#include "varint.hpp"
 
 namespace upd {
 
 template<typename, endianess, signed_mode, typename...>
 class tuple_view;
 
+//! \brief Tag type used to construct a \ref<tuple> tuple instance without initializing its content
+struct uninitialized_t {};
+
+//! \brief Token used to construct a \ref<tuple> tuple instance without initializing its content
+//!
+//! This is meant for tuples whose content is about to be overwritten (e.g. by bytes received from a device), so that
+//! the values are not serialized for nothing.
+constexpr uninitialized_t uninitialized;
+
 namespace detail {
 
 template<typename, endianess, signed_mode, typename...>
@@ -52,7 +72,7 @@ T &&normalize(T &&x) {
 //! \brief Return the size in bytes occupied by the serialization of instances of the provided type (if serializable)
 template<typename T, detail::require_is_serializable<T> = 0>
 constexpr std::size_t serialization_size_impl(...) {
-  return sizeof(T);
+  return serialized_width<T>::value;
 }
 template<typename T, detail::require_is_user_serializable<T> = 0>
 constexpr std::size_t serialization_size_impl(int) {
@@ -65,6 +85,250 @@ template<typename T>
 struct serialization_size {
   constexpr static auto value = serialization_size_impl<T>(0);
 };
+template<typename T, std::size_t N, endianess Endianess, signed_mode Signed_Mode>
+struct serialization_size<array_view<T, N, Endianess, Signed_Mode>> {
+  constexpr static auto value = serialized_width<T[N]>::value;
+};
+template<typename T>
+struct serialization_size<varint<T>> {
+  constexpr static auto value = varint<T>::max_size;
+};
+template<typename T, std::size_t N>
+struct serialization_size<bounded_vector<T, N>> {
+  constexpr static auto value = bounded_vector_storage_size<bounded_vector<T, N>>::value;
+};
+template<std::size_t N>
+struct serialization_size<bounded_string<N>> {
+  constexpr static auto value = bounded_vector_storage_size<bounded_string<N>>::value;
+};
+
+//! \brief Indicates whether the serialization of values of type `T` is their object representation
+//!
+//! Such values can be serialized and unserialized with a plain memory copy.
+template<endianess Endianess, signed_mode Signed_Mode, typename T>
+struct is_raw_serializable
+    : std::integral_constant<bool,
+                             (std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                              (sizeof(T) == 1 || platform_info.endianess == Endianess) &&
+                              (std::is_unsigned<T>::value || platform_info.signed_mode == Signed_Mode)) ||
+                                 (std::is_floating_point<T>::value && is_ieee_binary<T>::value &&
+                                  !is_user_serializable<T>::value && platform_info.endianess == Endianess)> {};
+template<endianess Endianess, signed_mode Signed_Mode, typename T, std::size_t N>
+struct is_raw_serializable<Endianess, Signed_Mode, T[N]> : is_raw_serializable<Endianess, Signed_Mode, T> {};
+template<endianess Endianess, signed_mode Signed_Mode, typename T, std::size_t N>
+struct is_raw_serializable<Endianess, Signed_Mode, std::array<T, N>> : is_raw_serializable<Endianess, Signed_Mode, T> {
+};
+
+//! \brief Position and serialization strategy of a value in a tuple storage
+template<std::size_t Offset, typename T, bool Is_Raw>
+struct layout_field {
+  //! \brief Type of the value
+  using type = T;
+
+  //! \brief Offset in bytes of the value in the storage
+  constexpr static auto offset = Offset;
+
+  //! \brief Whether the value is serialized with a plain memory copy
+  constexpr static auto is_raw = Is_Raw;
+};
+
+//! \brief Compile-time plan of the layout of a tuple storage
+//!
+//! The offset of each value and how it is serialized are computed once, so that accessing a value does not involve
+//! any other computation.
+template<typename Fields, std::size_t Size>
+struct layout_plan;
+template<typename... Fields, std::size_t Size>
+struct layout_plan<tlist_t<Fields...>, Size> {
+  //! \brief Typelist of `layout_field` instances
+  using fields_t = tlist_t<Fields...>;
+
+  //! \brief Size in bytes of the storage
+  constexpr static auto size = Size;
+
+  //! \brief Whether the whole storage is the object representation of the values
+  constexpr static auto is_raw = conjunction<std::integral_constant<bool, Fields::is_raw>...>::value;
+};
+
+//! \brief Compute the layout plan of a tuple storage in a single pass over `Ts...`
+template<endianess Endianess, signed_mode Signed_Mode, typename Fields, std::size_t Offset, typename... Ts>
+struct make_layout_plan {
+  using type = layout_plan<Fields, Offset>;
+};
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         typename... Fields,
+         std::size_t Offset,
+         typename T,
+         typename... Ts>
+struct make_layout_plan<Endianess, Signed_Mode, tlist_t<Fields...>, Offset, T, Ts...>
+    : make_layout_plan<
+          Endianess,
+          Signed_Mode,
+          tlist_t<Fields..., layout_field<Offset, T, is_raw_serializable<Endianess, Signed_Mode, T>::value>>,
+          Offset + serialization_size<T>::value,
+          Ts...> {};
+
+//! \copydoc make_layout_plan
+template<endianess Endianess, signed_mode Signed_Mode, typename... Ts>
+using layout_plan_t = typename make_layout_plan<Endianess, Signed_Mode, tlist_t<>, 0, Ts...>::type;
+
+//! \name
+//! \brief Unserialize a value of a tuple storage from the address of its layout field
+//! @{
+
+template<typename Field, endianess Endianess, signed_mode Signed_Mode, require<Field::is_raw> = 0>
+decltype(read_as<typename Field::type, Endianess, Signed_Mode>(nullptr)) read_field_at(const byte_t *ptr) {
+  decltype(read_as<typename Field::type, Endianess, Signed_Mode>(nullptr)) retval;
+  std::memcpy(&retval, ptr, sizeof(retval));
+
+  return retval;
+}
+template<typename Field, endianess Endianess, signed_mode Signed_Mode, require<!Field::is_raw> = 0>
+decltype(read_as<typename Field::type, Endianess, Signed_Mode>(nullptr)) read_field_at(const byte_t *ptr) {
+  return read_as<typename Field::type, Endianess, Signed_Mode>(ptr);
+}
+
+//! @}
+
+//! \name
+//! \brief Serialize a value into a tuple storage at the address of its layout field
+//! @{
+
+template<typename Field, endianess Endianess, signed_mode Signed_Mode, require<Field::is_raw> = 0>
+void write_field_at(const typename Field::type &value, byte_t *ptr) {
+  std::memcpy(ptr, &value, sizeof(value));
+}
+template<typename Field, endianess Endianess, signed_mode Signed_Mode, require<!Field::is_raw> = 0>
+void write_field_at(const typename Field::type &value, byte_t *ptr) {
+  write_as<Endianess, Signed_Mode>(value, ptr);
+}
+
+//! @}
+
+//! \name
+//! \brief Unserialize a value of a tuple storage according to its layout field
+//!
+//! Storages bound through a segmented iterator are read in place, unless the value straddles both segments, in which
+//! case it is gathered into a local buffer first.
+//! @{
+
+template<typename Field,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename It,
+         require<std::is_convertible<It, const byte_t *>::value> = 0>
+decltype(read_as<typename Field::type, Endianess, Signed_Mode>(nullptr)) read_field(const It &src) {
+  return read_field_at<Field, Endianess, Signed_Mode>(static_cast<const byte_t *>(src) + Field::offset);
+}
+template<typename Field,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename It,
+         require<!std::is_convertible<It, const byte_t *>::value && !is_segmented_iterator<It>::value> = 0>
+decltype(read_as<typename Field::type, Endianess, Signed_Mode>(nullptr)) read_field(const It &src) {
+  return read_as<typename Field::type, Endianess, Signed_Mode>(src, Field::offset);
+}
+template<typename Field, endianess Endianess, signed_mode Signed_Mode, typename T>
+decltype(read_as<typename Field::type, Endianess, Signed_Mode>(nullptr)) read_field(const segmented_iterator<T> &src) {
+  using type = typename Field::type;
+  static_assert(!is_array_view<type>::value, "Array views cannot be bound to a segmented byte sequence");
+
+  constexpr auto size = serialization_size<type>::value;
+  if (const byte_t *ptr = src.contiguous_range(Field::offset, size))
+    return read_field_at<Field, Endianess, Signed_Mode>(ptr);
+
+  byte_t buf[size];
+  src.copy_to(Field::offset, size, buf);
+  return read_field_at<Field, Endianess, Signed_Mode>(buf);
+}
+
+//! @}
+
+//! \name
+//! \brief Serialize a value into a tuple storage according to its layout field
+//!
+//! Storages bound through a segmented iterator are written in place, unless the value straddles both segments, in
+//! which case it is serialized into a local buffer first.
+//! @{
+
+template<typename Field,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename It,
+         require<std::is_convertible<It, byte_t *>::value> = 0>
+void write_field(const typename Field::type &value, const It &dest) {
+  write_field_at<Field, Endianess, Signed_Mode>(value, static_cast<byte_t *>(dest) + Field::offset);
+}
+template<typename Field,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename It,
+         require<!std::is_convertible<It, byte_t *>::value && !is_segmented_iterator<It>::value> = 0>
+void write_field(const typename Field::type &value, const It &dest) {
+  write_as<Endianess, Signed_Mode>(value, dest, Field::offset);
+}
+template<typename Field, endianess Endianess, signed_mode Signed_Mode>
+void write_field(const typename Field::type &value, const segmented_iterator<byte_t> &dest) {
+  constexpr auto size = serialization_size<typename Field::type>::value;
+  if (byte_t *ptr = dest.contiguous_range(Field::offset, size))
+    return write_field_at<Field, Endianess, Signed_Mode>(value, ptr);
+
+  byte_t buf[size];
+  write_field_at<Field, Endianess, Signed_Mode>(value, buf);
+  dest.copy_from(Field::offset, size, buf);
+}
+
+//! @}
+
+//! \brief Sequential reader unserializing the values of a tuple storage while walking it exactly once
+//!
+//! Iterators to contiguous storage are converted once to a pointer, from which every field is read in place (with a
+//! plain memory copy when the field is raw). Any other iterator is advanced byte by byte, each field being gathered
+//! into a local buffer before being unserialized, so that single-pass iterators can be used as well.
+template<typename It, endianess Endianess, signed_mode Signed_Mode, bool = is_contiguous_byte_iterator<It>::value>
+class field_cursor {
+public:
+  explicit field_cursor(const It &it) : m_it{it} {}
+
+  //! \brief Unserialize the value described by the next field
+  template<typename Field>
+  decltype(read_as<typename Field::type, Endianess, Signed_Mode>(nullptr)) next() {
+    using T = typename Field::type;
+    static_assert(!is_array_view<T>::value, "Array views cannot be decoded from a non-contiguous byte sequence");
+
+    byte_t buf[serialization_size<T>::value];
+    for (byte_t &byte : buf) {
+      byte = *m_it;
+      ++m_it;
+    }
+
+    return read_as<T, Endianess, Signed_Mode>(static_cast<const byte_t *>(buf));
+  }
+
+private:
+  It m_it;
+};
+template<typename It, endianess Endianess, signed_mode Signed_Mode>
+class field_cursor<It, Endianess, Signed_Mode, true> {
+public:
+  explicit field_cursor(const It &it) : m_ptr{address_of(it)} {}
+
+  //! \brief Unserialize the value described by the next field
+  template<typename Field>
+  decltype(read_as<typename Field::type, Endianess, Signed_Mode>(nullptr)) next() const {
+    return read_field<Field, Endianess, Signed_Mode>(m_ptr);
+  }
+
+private:
+  const byte_t *m_ptr;
+};
+
+//! \brief Make a cursor walking a tuple storage from the given iterator
+template<endianess Endianess, signed_mode Signed_Mode, typename It>
+field_cursor<It, Endianess, Signed_Mode> make_field_cursor(const It &it) {
+  return field_cursor<It, Endianess, Signed_Mode>{it};
+}
 
 //! \brief Make a tuple view according to a typelist
 template<endianess Endianess, signed_mode Signed_Mode, typename It, typename... Ts>
@@ -99,6 +363,9 @@ public:
   //! \brief Typelist holding the sizes in byte of each type of `Ts...` when serialized
   using sizes_t = upd::typelist_t<serialization_size<Ts>...>;
 
+  //! \brief Layout plan of the storage
+  using plan_t = detail::layout_plan_t<Endianess, Signed_Mode, Ts...>;
+
   //! \brief Type of one of the serialized values
   //! \tparam I Index of the requested type in `Ts...`
   template<std::size_t I>
@@ -115,7 +382,7 @@ public:
 
   //! \brief Copy each element of a tuple-like object into the content
   //! \param t Tuple-like object to copy from
-  template<typename Tuple, UPD_REQUIREMENT(is_tuple, Tuple)>
+  template<typename Tuple, UPD_REQUIREMENT(is_tuple, remove_cv_ref_t<Tuple>)>
   D &operator=(Tuple &&t) {
     lay_tuple(make_index_sequence<sizeof...(Ts)>{}, UPD_FWD(t));
     return derived();
@@ -130,11 +397,7 @@ public:
 #else
   template<std::size_t I>
   decltype(read_as<arg_t<I>, Endianess, Signed_Mode>(nullptr)) get() const {
-    using detail::clip;
-    using detail::sum;
-
-    constexpr auto offset = sum<clip<sizes_t, 0, I>>::value;
-    return read_as<arg_t<I>, Endianess, Signed_Mode>(derived().src(), offset);
+    return read_field<field_t<I>, Endianess, Signed_Mode>(derived().src());
   }
 #endif
 
@@ -143,11 +406,7 @@ public:
   //! \param value Value to be copied from
   template<std::size_t I>
   void set(const arg_t<I> &value) {
-    using detail::clip;
-    using detail::sum;
-
-    constexpr auto offset = sum<clip<sizes_t, 0, I>>::value;
-    write_as<Endianess, Signed_Mode>(value, derived().src(), offset);
+    write_field<field_t<I>, Endianess, Signed_Mode>(value, derived().src());
   }
 
   //! \brief Invoke a functor with the stored values
@@ -163,6 +422,29 @@ public:
   }
 #endif
 
+  //! \brief `std::tuple` instance holding every unserialized value
+  using values_t = std::tuple<decltype(read_as<Ts, Endianess, Signed_Mode>(nullptr))...>;
+
+  //! \brief Unserialize every value held by the object in a single pass
+  //!
+  //! Unlike a sequence of calls to `get()`, the byte sequence is walked exactly once, from its beginning to its end,
+  //! which makes this function suitable for sequences bound through a single-pass iterator (such as
+  //! `std::istreambuf_iterator`) or through an iterator which is not random access (such as `std::list::iterator`).
+  //!
+  //! \return A `std::tuple` instance holding the values, where arrays are held as `std::array` instances
+  values_t decode_all() const { return decode_all_impl(make_index_sequence<sizeof...(Ts)>{}); }
+
+  //! \brief Invoke a functor on each value held by the object, in order, in a single pass
+  //!
+  //! The byte sequence is walked the same way as `decode_all()`, but the values are handed over to the functor one at a
+  //! time as they are unserialized.
+  //!
+  //! \param ftor Functor invocable on each type of `Ts...` (arrays being passed as `std::array` instances)
+  template<typename F>
+  void for_each_field(F &&ftor) const {
+    for_each_field_impl(ftor, make_index_sequence<sizeof...(Ts)>{});
+  }
+
 protected:
   //! \brief Serialize values into the object content
   template<std::size_t... Is, typename... Args>
@@ -172,12 +454,52 @@ protected:
   }
 
   //! \brief Lay the element of a tuple-like object into the content
+  //!
+  //! If the tuple-like object has the same storage layout, its content is copied as is.
   template<std::size_t... Is, typename T>
   void lay_tuple(detail::index_sequence<Is...> is, T &&t) {
-    lay(is, t.template get<Is>()...);
+    using tuple_t = remove_cv_ref_t<T>;
+
+    lay_tuple_impl(is, UPD_FWD(t), has_same_layout<tuple_t>{});
   }
 
 private:
+  //! \brief Layout field of one of the serialized values
+  template<std::size_t I>
+  using field_t = detail::at<typename plan_t::fields_t, I>;
+
+  //! \brief Indicates whether the storage of the tuple-like type `T` can be copied as is into this storage
+  template<typename T>
+  using has_same_layout = std::integral_constant<
+      bool,
+      std::is_same<typename T::types_t, types_t>::value &&
+          ((T::storage_endianess == Endianess && T::storage_signed_mode == Signed_Mode) ||
+           (T::plan_t::is_raw && plan_t::is_raw))>;
+
+  template<std::size_t... Is, typename T>
+  void lay_tuple_impl(detail::index_sequence<Is...>, T &&t, std::true_type) {
+    std::copy(t.begin(), t.end(), derived().src());
+  }
+  template<std::size_t... Is, typename T>
+  void lay_tuple_impl(detail::index_sequence<Is...> is, T &&t, std::false_type) {
+    lay(is, detail::normalize<Ts>(t.template get<Is>())...);
+  }
+
+  //! \brief Unserialize the tuple content in order (the braced initializer list sequences the calls)
+  template<std::size_t... Is>
+  values_t decode_all_impl(detail::index_sequence<Is...>) const {
+    auto cursor = detail::make_field_cursor<Endianess, Signed_Mode>(derived().begin());
+    return values_t{cursor.template next<field_t<Is>>()...};
+  }
+
+  //! \brief Unserialize the tuple content in order and forward each value to the provided functor
+  template<typename F, std::size_t... Is>
+  void for_each_field_impl(F &ftor, detail::index_sequence<Is...>) const {
+    using discard = int[];
+    auto cursor = detail::make_field_cursor<Endianess, Signed_Mode>(derived().begin());
+    (void)discard{0, ((void)ftor(cursor.template next<field_t<Is>>()), 0)...};
+  }
+
   //! \brief Unserialize the tuple content and forward it as parameters to the provided functor
   template<typename F, std::size_t... Is>
   detail::return_t<F> invoke_impl(F &&ftor, detail::index_sequence<Is...>) const {
@@ -220,8 +542,13 @@ void set(detail::tuple_base<D, Endianess, Signed_Mode, Ts...> &t, U &&value) {
 //! Once bound, the byte sequence content can be read and modified as it were the content of a \ref<tuple> tuple
 //! instance. The byte sequence and the tuple view are bound through an iterator. It must at least be a forward
 //! iterator, but tuple views are faster with random access iterators. Best case would be a non-volatile plain pointer,
-//! as it can be called with memcpy. \tparam It Type of the iterator used for binding with the byte sequence \tparam
-//! Endianess, Signed_Mode Serialization parameters \tparam Ts... Types of the serialized values
+//! as it can be called with memcpy. Views bound through a single-pass input iterator can only be read once with
+//! `decode_all()` or `for_each_field()`, and their `end()` is not computed. A \ref<segmented_iterator>
+//! segmented_iterator instance allows binding a view to a byte sequence wrapping around the end of a ring buffer.
+//!
+//! \tparam It Type of the iterator used for binding with the byte sequence
+//! \tparam Endianess, Signed_Mode Serialization parameters
+//! \tparam Ts... Types of the serialized values
 template<typename It, endianess Endianess, signed_mode Signed_Mode, typename... Ts>
 class tuple_view
     : public detail::tuple_base<tuple_view<It, Endianess, Signed_Mode, Ts...>, Endianess, Signed_Mode, Ts...> {
@@ -232,7 +559,9 @@ public:
 
   //! \brief Bind the view to a byte sequence through an iterator
   //! \param src Iterator to the start of the byte sequence
-  explicit tuple_view(const It &src) : m_begin{src}, m_end{src} { std::advance(m_end, base_t::size); }
+  explicit tuple_view(const It &src) : m_begin{src}, m_end{src} {
+    advance_end(typename std::iterator_traits<It>::iterator_category{});
+  }
 
   //! \brief Beginning of the byte sequence
   const It &begin() const { return m_begin; }
@@ -245,6 +574,13 @@ public:
   const It &src() const { return m_begin; }
 
 private:
+  //! \brief Make `m_end` designate the end of the byte sequence
+  //!
+  //! Advancing a copy of a single-pass iterator would consume the byte sequence, so `m_end` is left equal to
+  //! `m_begin` for those.
+  void advance_end(std::forward_iterator_tag) { std::advance(m_end, base_t::size); }
+  void advance_end(std::input_iterator_tag) {}
+
   It m_begin, m_end;
 };
 
@@ -303,10 +639,14 @@ auto make_view(const tuple<Endianess, Signed_Mode, Ts...> &tuple) -> decltype(tu
 template<endianess Endianess, signed_mode Signed_Mode, typename... Ts>
 class tuple : public detail::tuple_base<tuple<Endianess, Signed_Mode, Ts...>, Endianess, Signed_Mode, Ts...> {
   using base_t = detail::tuple_base<tuple<Endianess, Signed_Mode, Ts...>, Endianess, Signed_Mode, Ts...>;
+
+public:
+  //! \copydoc detail::tuple_base::types_t
   using types_t = typename base_t::types_t;
+
+  //! \copydoc detail::tuple_base::sizes_t
   using sizes_t = typename base_t::sizes_t;
 
-public:
   using base_t::operator=;
 
   //! \brief Initialize the internal storage with default constructed values
@@ -316,6 +656,11 @@ public:
   //! \param args... Values to be serialized
   explicit tuple(const Ts &...args) { base_t::lay(detail::make_index_sequence<sizeof...(Ts)>{}, args...); }
 
+  //! \brief Leave the internal storage uninitialized
+  //!
+  //! The content must be written (e.g. through begin()) before any value is read from the tuple.
+  explicit tuple(uninitialized_t) {}
+
 #if __cplusplus >= 201703L
   //! \brief (C++17) Serialize the provided values
   //!
@@ -401,6 +746,9 @@ private:
 template<endianess Endianess, signed_mode Signed_Mode>
 class tuple<Endianess, Signed_Mode> : public detail::tuple_base<tuple<Endianess, Signed_Mode>, Endianess, Signed_Mode> {
 public:
+  tuple() = default;
+  explicit tuple(uninitialized_t) {}
+
   constexpr byte_t *begin() const { return nullptr; }
   constexpr byte_t *end() const { return nullptr; }
   constexpr byte_t *src() const { return begin(); }
@@ -411,10 +759,13 @@ public:
 //! \param args... Values to be serialized into the return value
 //! \return a \ref<tuple> tuple instance initialized from `args...`
 //! \related tuple
+//!
+//! The values are taken by forwarding reference so that this overload stays more specialized than `std::make_tuple`
+//! when the latter is found through argument-dependent lookup.
 template<endianess Endianess, signed_mode Signed_Mode, typename... Args>
-tuple<Endianess, Signed_Mode, Args...>
-make_tuple(endianess_h<Endianess>, signed_mode_h<Signed_Mode>, const Args &...args) {
-  return tuple<Endianess, Signed_Mode, Args...>{args...};
+tuple<Endianess, Signed_Mode, detail::remove_cv_ref_t<Args>...>
+make_tuple(endianess_h<Endianess>, signed_mode_h<Signed_Mode>, Args &&...args) {
+  return tuple<Endianess, Signed_Mode, detail::remove_cv_ref_t<Args>...>{args...};
 }
 
 //! \brief Construct a \ref<tuple> tuple instance holding default values
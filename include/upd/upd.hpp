@@ -6,12 +6,51 @@
 #define UPD_PACK(...) __VA_ARGS__
 #define UPD_SCOPE_OPERATOR(LHS, RHS) LHS::RHS
 
+// Mark functions whose body is not allowed in a C++11 `constexpr` function but can be evaluated at compile time from
+// C++17
+#if __cplusplus >= 201703L
+#define UPD_CONSTEXPR_17 constexpr
+#else  // __cplusplus >= 201703L
+#define UPD_CONSTEXPR_17
+#endif // __cplusplus >= 201703L
+
+// Detect the platform endianess and signed number representation, unless they are provided by the user or
+// `UPD_NO_PLATFORM_DETECTION` is defined
+#if !defined(UPD_NO_PLATFORM_DETECTION)
+
+#if !defined(UPD_PLATFORM_ENDIANESS)
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define UPD_PLATFORM_ENDIANESS LITTLE
+#elif defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define UPD_PLATFORM_ENDIANESS BIG
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM) || defined(_M_ARM64))
+#define UPD_PLATFORM_ENDIANESS LITTLE
+#endif
+#endif // !defined(UPD_PLATFORM_ENDIANESS)
+
+// The preprocessor evaluates `-1` with the signed number representation of the platform
+#if !defined(UPD_PLATFORM_SIGNED_MODE)
+#if (-1 & 3) == 3
+#define UPD_PLATFORM_SIGNED_MODE TWOS_COMPLEMENT
+#elif (-1 & 3) == 2
+#define UPD_PLATFORM_SIGNED_MODE ONES_COMPLEMENT
+#elif (-1 & 3) == 1
+#define UPD_PLATFORM_SIGNED_MODE SIGNED_MAGNITUDE
+#endif
+#endif // !defined(UPD_PLATFORM_SIGNED_MODE)
+
+#endif // !defined(UPD_NO_PLATFORM_DETECTION)
+
 namespace upd {
 
-//! \brief Contains the platform-specific information provided by the user
+//! \brief Contains the platform-specific information
 //!
 //! `platform_info.endianess` equals `UPD_PLATFORM_ENDIANESS`.
 //! `platform_info.signed_mode` equals `UPD_PLATFORM_SIGNED_MODE`.
+//!
+//! If these macros are not provided by the user, they are detected from the compiler predefined macros. When
+//! detection fails, the corresponding member compares unequal to every enumerator and the platform-agnostic
+//! implementations are used.
 constexpr struct {
 #if defined(UPD_PLATFORM_ENDIANESS)
   upd::endianess endianess = UPD_SCOPE_OPERATOR(upd::endianess, UPD_PLATFORM_ENDIANESS);
@@ -36,3 +75,11 @@ constexpr struct {
 
 template<typename>
 struct upd_extension; // IWYU pragma: keep
+
+//! \brief Range of the values of an enumeration type
+//!
+//! Specializations must have two `constexpr static` data members of type `E`, `min` and `max`, holding the smallest
+//! and the greatest enumerator. Values of type `E` are then serialized the same way as `upd::ranged<E, min, max>`
+//! instances.
+template<typename E>
+struct upd_enum_range; // IWYU pragma: keep
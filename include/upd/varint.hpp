@@ -0,0 +1,134 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "type.hpp"
+
+namespace upd {
+
+//! \brief Integer sent on the wire with as few bytes as its value needs
+//!
+//! Varints are serialized as LEB128: seven bits of the value per byte, least significant group first, the most
+//! significant bit of each byte indicating whether another byte follows. Signed values are zigzag-encoded beforehand
+//! (`0`, `-1`, `1`, `-2`, ... are mapped to `0`, `1`, `2`, `3`, ...), so that small negative values are short as well.
+//! The serialization parameters of the keyring have no effect on varints.
+//!
+//! In a \ref<tuple> tuple storage, a varint occupies `max_size` bytes, whereas a `varint<std::uint32_t>` holding `100`
+//! is sent as a single byte.
+//!
+//! \note Varints cannot be array elements.
+//!
+//! \tparam T Integer type of the value
+template<typename T>
+class varint {
+  static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value, "Varints must hold an integer type");
+
+public:
+  //! \brief Type of the value
+  using value_type = T;
+
+  //! \brief Greatest size in bytes of the serialized representation
+  constexpr static std::size_t max_size = (sizeof(T) * 8 + 6) / 7;
+
+  constexpr varint() = default;
+
+  //! \brief Hold a value
+  constexpr varint(T value) : m_value{value} {}
+
+  //! \brief Get the value
+  constexpr T value() const { return m_value; }
+
+  //! \copydoc value
+  constexpr operator T() const { return m_value; }
+
+private:
+  T m_value = 0;
+};
+
+template<typename T>
+constexpr std::size_t varint<T>::max_size;
+
+namespace detail {
+
+//! \name
+//! \brief Map a signed value to an unsigned one, small magnitudes being mapped to small values
+//! @{
+
+template<typename T, typename std::enable_if<std::is_unsigned<T>::value, int>::type = 0>
+unsigned long long zigzag_encode(T value) {
+  return value;
+}
+template<typename T, typename std::enable_if<std::is_signed<T>::value, int>::type = 0>
+unsigned long long zigzag_encode(T value) {
+  auto bits = static_cast<unsigned long long>(value);
+  return value < 0 ? ~(bits << 1) : bits << 1;
+}
+
+//! @}
+
+//! \name
+//! \brief Inverse of `zigzag_encode`
+//! @{
+
+template<typename T, typename std::enable_if<std::is_unsigned<T>::value, int>::type = 0>
+T zigzag_decode(unsigned long long value) {
+  return static_cast<T>(value);
+}
+template<typename T, typename std::enable_if<std::is_signed<T>::value, int>::type = 0>
+T zigzag_decode(unsigned long long value) {
+  auto magnitude = static_cast<T>((value >> 1) & static_cast<unsigned long long>(std::numeric_limits<T>::max()));
+  return value & 1 ? static_cast<T>(-magnitude - 1) : magnitude;
+}
+
+//! @}
+
+//! \brief Serialize a value as LEB128
+//! \return the number of bytes written
+template<typename T>
+std::size_t write_varint(T value, byte_t *dest) {
+  auto bits = zigzag_encode(value);
+  std::size_t i = 0;
+
+  for (; bits >= 0x80; bits >>= 7)
+    dest[i++] = static_cast<byte_t>(bits | 0x80);
+  dest[i++] = static_cast<byte_t>(bits);
+
+  return i;
+}
+
+//! \brief Unserialize a value serialized as LEB128
+//!
+//! No byte past the last byte of the representation is read.
+template<typename T>
+T read_varint(const byte_t *src) {
+  unsigned long long bits = 0;
+
+  for (std::size_t i = 0; i < varint<T>::max_size; i++) {
+    bits |= static_cast<unsigned long long>(src[i] & 0x7f) << (7 * i);
+    if (!(src[i] & 0x80))
+      break;
+  }
+
+  return zigzag_decode<T>(bits);
+}
+
+//! \brief Length in bytes of the LEB128 representation of a value of type `T`
+//!
+//! Only the first `available` bytes of `src` are inspected. If the representation does not end among them, a lower
+//! bound of its length greater than `available` is returned instead.
+template<typename T>
+std::size_t varint_length(const byte_t *src, std::size_t available) {
+  for (std::size_t i = 0; i < available; i++) {
+    if (!(src[i] & 0x80) || i + 1 == varint<T>::max_size)
+      return i + 1;
+  }
+
+  return available + 1;
+}
+
+} // namespace detail
+} // namespace upd
@@ -28,6 +28,19 @@ static void action_DO_give_then_return_argument_from_action_EXPECT_unaltered_val
   TEST_ASSERT_EQUAL_INT(argument, serialized_return_value.get<0>());
 }
 
+static void action_DO_call_on_contiguous_buffers_EXPECT_unaltered_value() {
+  using namespace upd;
+
+  auto serialized_arguments = upd::make_tuple(little_endian, twos_complement, int{0xabc}, short{-0xd});
+  auto serialized_return_value = upd::make_tuple(little_endian, twos_complement, int{0});
+  action add{[](int x, short y) { return x + y; }, upd::little_endian, upd::twos_complement};
+
+  auto written = add.call(serialized_arguments.begin(), serialized_return_value.begin());
+
+  TEST_ASSERT_EQUAL_INT(sizeof(int), written);
+  TEST_ASSERT_EQUAL_INT(0xabc - 0xd, serialized_return_value.get<0>());
+}
+
 static void action_DO_instantiate_action_with_functor_taking_arguments_EXPECT_input_and_output_sizes_correct() {
   using namespace upd;
 
@@ -64,15 +77,42 @@ static void action_DO_instantiate_action_with_functor_non_returning_EXPECT_input
   TEST_ASSERT_EQUAL_INT(0, f.output_size());
 }
 
+static void action_DO_move_small_and_large_actions_EXPECT_callbacks_preserved() {
+  using namespace upd;
+
+  auto serialized_argument = upd::make_tuple(little_endian, twos_complement, int{0xabc});
+  auto serialized_return_value = upd::make_tuple(little_endian, twos_complement, int{0});
+  int offset = 1;
+  int offsets[16] = {2};
+
+  inplace_action<sizeof(int)> small{[offset](int x) { return x + offset; }, little_endian, twos_complement};
+  inplace_action<sizeof(int)> large{[offsets](int x) { return x + offsets[0]; }, little_endian, twos_complement};
+  TEST_ASSERT_TRUE(small.is_stored_in_place());
+  TEST_ASSERT_FALSE(large.is_stored_in_place());
+
+  inplace_action<sizeof(int)> moved_small{std::move(small)}, moved_large;
+  moved_large = std::move(large);
+  TEST_ASSERT_TRUE(moved_small.is_stored_in_place());
+  TEST_ASSERT_EQUAL_UINT(0, small.call(serialized_argument.begin(), serialized_return_value.begin()));
+  TEST_ASSERT_EQUAL_UINT(0, large.call(serialized_argument.begin(), serialized_return_value.begin()));
+
+  moved_small.call(serialized_argument.begin(), serialized_return_value.begin());
+  TEST_ASSERT_EQUAL_INT(0xabc + 1, serialized_return_value.get<0>());
+  moved_large.call(serialized_argument.begin(), serialized_return_value.begin());
+  TEST_ASSERT_EQUAL_INT(0xabc + 2, serialized_return_value.get<0>());
+}
+
 int main() {
   using namespace upd;
 
   UNITY_BEGIN();
   RUN_TEST(action_DO_serialize_argument_into_stream_EXPECT_action_getting_unaltered_argument);
   RUN_TEST(action_DO_give_then_return_argument_from_action_EXPECT_unaltered_value);
+  RUN_TEST(action_DO_call_on_contiguous_buffers_EXPECT_unaltered_value);
   RUN_TEST(action_DO_instantiate_action_with_functor_taking_arguments_EXPECT_input_and_output_sizes_correct);
   RUN_TEST(action_DO_instantiate_action_with_functor_taking_no_arguments_EXPECT_input_and_output_sizes_correct);
   RUN_TEST(action_DO_instantiate_action_with_functor_returning_non_tuple_EXPECT_input_and_output_sizes_correct);
   RUN_TEST(action_DO_instantiate_action_with_functor_non_returning_EXPECT_input_and_output_sizes_correct);
+  RUN_TEST(action_DO_move_small_and_large_actions_EXPECT_callbacks_preserved);
   return UNITY_END();
 }
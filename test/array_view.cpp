@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <cstdint>
+
+#include <upd/array_view.hpp>
+#include <upd/dispatcher.hpp>
+#include <upd/keyring.hpp>
+#include <upd/tuple.hpp>
+
+#include "utility.hpp"
+
+using values_view_t = upd::array_view<std::int32_t, 64, upd::endianess::BIG, upd::signed_mode::ONES_COMPLEMENT>;
+
+std::int64_t sum_odd_elements(values_view_t values) {
+  std::int64_t retval = 0;
+  for (std::size_t i = 1; i < values.size(); i += 2)
+    retval += values[i];
+  return retval;
+}
+
+constexpr auto kring =
+    upd::make_keyring(upd::make_flist(UPD_CTREF(sum_odd_elements)), upd::big_endian, upd::ones_complement);
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void array_view_DO_view_serialized_array_EXPECT_same_elements() {
+  using namespace upd;
+
+  std::int16_t array[] = {-0xabc, 0, 0x7fff, -1, 0x42};
+  auto t = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, char{}, array);
+  using view_t = array_view<std::int16_t, 5, Endianess, Signed_Mode>;
+  auto view = tuple_view<const byte_t *, Endianess, Signed_Mode, char, view_t>{t.begin()}.template get<1>();
+
+  TEST_ASSERT_EQUAL_UINT(5, view.size());
+  TEST_ASSERT_TRUE(view.data() == t.begin() + 1);
+  TEST_ASSERT_EQUAL_INT16(-0xabc, view.front());
+  TEST_ASSERT_EQUAL_INT16(0x42, view.back());
+  TEST_ASSERT_EQUAL_INT16(-1, view[3]);
+  TEST_ASSERT_EQUAL_INT(5, view.end() - view.begin());
+  TEST_ASSERT_TRUE(std::equal(view.begin(), view.end(), std::begin(array)));
+  TEST_ASSERT_TRUE(std::equal(std::reverse_iterator<decltype(view.end())>(view.end()),
+                              std::reverse_iterator<decltype(view.begin())>(view.begin()),
+                              std::reverse_iterator<std::int16_t *>(std::end(array))));
+}
+
+MAKE_MULTIOPT(array_view_DO_view_serialized_array_EXPECT_same_elements)
+
+static void array_view_DO_call_action_taking_an_array_view_EXPECT_packet_holding_plain_array() {
+  using namespace upd;
+
+  std::int32_t values[64];
+  for (std::size_t i = 0; i < 64; i++)
+    values[i] = static_cast<std::int32_t>(i % 2 ? -i : i);
+
+  byte_t buf[512], *ptr = buf;
+  auto k = kring.get(UPD_CTREF(sum_odd_elements));
+  auto dis = make_dispatcher(kring, policy::weak_reference);
+
+  static_assert(std::is_same<decltype(k)::signature_t, std::int64_t(const std::int32_t(&)[64])>::value, "");
+  static_assert(k.payload_length == sizeof(decltype(k)::index_t) + sizeof(values), "");
+
+  k(values).write_to(buf);
+  dis([&]() { return *ptr++; }, [&](byte_t byte) { *ptr++ = byte; });
+  TEST_ASSERT_EQUAL_INT64(-32 * 32, k.read_from(buf + k.payload_length));
+}
+
+int main() {
+  UNITY_BEGIN();
+  array_view_DO_view_serialized_array_EXPECT_same_elements_multiopt(every_options);
+  RUN_TEST(array_view_DO_call_action_taking_an_array_view_EXPECT_packet_holding_plain_array);
+  return UNITY_END();
+}
@@ -0,0 +1,117 @@
+#include <cstdint>
+#include <iterator>
+#include <list>
+
+#include <upd/bounded_vector.hpp>
+#include <upd/buffered_dispatcher.hpp>
+#include <upd/dispatcher.hpp>
+#include <upd/keyring.hpp>
+#include <upd/tuple.hpp>
+
+#include "utility.hpp"
+
+upd::bounded_string<24> greet(upd::bounded_string<16> name, upd::bounded_vector<std::int16_t, 4> scores) {
+  upd::bounded_string<24> retval{"hi "};
+  for (char c : name)
+    retval.push_back(c);
+  for (auto score : scores)
+    retval.push_back(score < 0 ? '-' : '+');
+
+  return retval;
+}
+
+constexpr auto kring = upd::make_keyring(upd::make_flist(UPD_CTREF(greet)), upd::little_endian, upd::twos_complement);
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void bounded_vector_DO_serialize_value_EXPECT_size_prefix_then_elements() {
+  using namespace upd;
+
+  auto t = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{},
+                      bounded_vector<std::uint16_t, 200>{0x0102, 0x0304}, bounded_string<10>{"upd"});
+  using tuple_t = decltype(t);
+
+  TEST_ASSERT_EQUAL_UINT(2 + 400 + 2 + 10, t.size);
+  TEST_ASSERT_EQUAL_UINT(1 + 4 + 1 + 3, detail::wire_format<tuple_t>::size(t.begin()));
+  TEST_ASSERT_EQUAL_HEX8(0x02, t.begin()[0]);
+  TEST_ASSERT_EQUAL_HEX8(Endianess == endianess::LITTLE ? 0x02 : 0x01, t.begin()[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x03, t.begin()[402]);
+
+  TEST_ASSERT_TRUE((bounded_vector<std::uint16_t, 200>{0x0102, 0x0304} == t.template get<0>()));
+  TEST_ASSERT_TRUE(bounded_string<10>{"upd"} == t.template get<1>());
+}
+
+MAKE_MULTIOPT(bounded_vector_DO_serialize_value_EXPECT_size_prefix_then_elements)
+
+static void bounded_vector_DO_unserialize_oversized_prefix_EXPECT_size_truncated_to_capacity() {
+  using namespace upd;
+  using vector_t = bounded_vector<std::uint8_t, 4>;
+
+  byte_t storage[detail::serialization_size<vector_t>::value] = {100, 1, 2, 3, 4};
+  TEST_ASSERT_EQUAL_UINT(1 + 4, detail::wire_length<vector_t>(storage, sizeof storage));
+  auto v = detail::read_as<vector_t, endianess::LITTLE, signed_mode::TWOS_COMPLEMENT>(storage);
+  TEST_ASSERT_EQUAL_UINT(4, v.size());
+  TEST_ASSERT_EQUAL_UINT(1, detail::wire_length<vector_t>(storage, 0));
+
+  vector_t full{1, 2, 3, 4};
+  TEST_ASSERT_FALSE(full.push_back(5));
+  TEST_ASSERT_TRUE((vector_t{1, 2, 3, 4, 5} == full));
+  TEST_ASSERT_EQUAL_UINT(3, bounded_string<3>{"upd serialization"}.size());
+}
+
+static void bounded_vector_DO_serialize_through_iterator_EXPECT_only_wire_representation_walked() {
+  using namespace upd;
+
+  using vector_t = bounded_vector<std::int16_t, 8>;
+
+  std::list<byte_t> bytes;
+  detail::write_as<endianess::BIG, signed_mode::TWOS_COMPLEMENT>(vector_t{-2, 3}, std::back_inserter(bytes));
+  bytes.push_back(0xff);
+  TEST_ASSERT_EQUAL_UINT(1 + 4 + 1, bytes.size());
+
+  auto v = detail::read_as<vector_t, endianess::BIG, signed_mode::TWOS_COMPLEMENT>(bytes.begin());
+  TEST_ASSERT_TRUE((vector_t{-2, 3} == v));
+}
+
+static void bounded_vector_DO_call_callback_EXPECT_short_request_and_response() {
+  using namespace upd;
+
+  auto k = kring.get(UPD_CTREF(greet));
+  auto dis = make_dispatcher(kring, policy::any_callback);
+  byte_t packet[k.payload_length], response[32], *ptr = packet;
+
+  auto size = k.encode_into(packet, "bob", bounded_vector<std::int16_t, 4>{-1, 1});
+  TEST_ASSERT_EQUAL_UINT(1 + 1 + 3 + 1 + 4, size);
+
+  std::size_t written = 0;
+  dis([&]() { return *ptr++; }, [&](byte_t byte) { response[written++] = byte; });
+  TEST_ASSERT_EQUAL_UINT(size, ptr - packet);
+  TEST_ASSERT_EQUAL_UINT(1 + 8, written);
+  TEST_ASSERT_TRUE(bounded_string<24>{"hi bob-+"} == k.read_from(response));
+}
+
+static void bounded_vector_DO_put_packets_back_to_back_EXPECT_each_packet_framed() {
+  using namespace upd;
+
+  auto k = kring.get(UPD_CTREF(greet));
+  auto dis = make_double_buffered_dispatcher(kring, policy::any_callback);
+  byte_t packets[2 * k.payload_length], result[32];
+  std::size_t size = k.encode_into(packets, "", bounded_vector<std::int16_t, 4>{});
+  size += k.encode_into(packets + size, "alice", bounded_vector<std::int16_t, 4>{7});
+
+  for (std::size_t i = 0; i < size; i++) {
+    if (dis.put(packets[i]) == packet_status::RESOLVED_PACKET) {
+      dis.write_to(result);
+      TEST_ASSERT_TRUE(bounded_string<24>{i + 1 == size ? "hi alice+" : "hi "} == k.read_from(result));
+    }
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  bounded_vector_DO_serialize_value_EXPECT_size_prefix_then_elements_multiopt(every_options);
+  RUN_TEST(bounded_vector_DO_unserialize_oversized_prefix_EXPECT_size_truncated_to_capacity);
+  RUN_TEST(bounded_vector_DO_serialize_through_iterator_EXPECT_only_wire_representation_walked);
+  RUN_TEST(bounded_vector_DO_call_callback_EXPECT_short_request_and_response);
+  RUN_TEST(bounded_vector_DO_put_packets_back_to_back_EXPECT_each_packet_framed);
+  return UNITY_END();
+}
@@ -1,3 +1,7 @@
+#include <iterator>
+#include <list>
+#include <vector>
+
 #include <upd/buffered_dispatcher.hpp>
 #include <upd/keyring.hpp>
 #include <upd/unevaluated.hpp>
@@ -28,6 +32,36 @@ void reply_std_array(const std::array<upd::byte_t, 16> &payload) { reply_hook(pa
 constexpr auto reply_kring = upd::make_keyring(
     upd::make_flist(UPD_CTREF(reply), UPD_CTREF(reply_std_array)), upd::little_endian, upd::twos_complement);
 
+using sum_args_t =
+    upd::tuple_view<const upd::byte_t *, upd::endianess::LITTLE, upd::signed_mode::TWOS_COMPLEMENT, int, std::int64_t>;
+
+std::int64_t sum(sum_args_t args) { return args.get<0>() + args.get<1>(); }
+
+constexpr auto view_kring =
+    upd::make_keyring(upd::make_flist(UPD_CTREF(sum)), upd::little_endian, upd::twos_complement);
+
+const std::uint16_t calibration_table[] = {0x0123, 0x4567, 0x89ab, 0xcdef, 0xfedc, 0xba98, 0x7654, 0x3210};
+
+void read_calibration_table(
+    upd::tuple_view<upd::byte_t *, upd::endianess::LITTLE, upd::signed_mode::TWOS_COMPLEMENT, std::uint16_t[8]> out) {
+  out.set<0>(calibration_table);
+}
+
+void increment_all(
+    upd::array_view<std::int16_t, 8, upd::endianess::LITTLE, upd::signed_mode::TWOS_COMPLEMENT> values,
+    upd::tuple_view<upd::byte_t *, upd::endianess::LITTLE, upd::signed_mode::TWOS_COMPLEMENT, std::int16_t[8]> out) {
+  std::int16_t result[8] = {};
+  out.set<0>(result);
+  for (std::size_t i = 0; i < values.size(); i++)
+    result[i] = static_cast<std::int16_t>(values[i] + 1);
+  out.set<0>(result);
+}
+
+constexpr auto output_view_kring = upd::make_keyring(upd::make_flist(UPD_CTREF(read_calibration_table),
+                                                                     UPD_CTREF(increment_all)),
+                                                     upd::little_endian,
+                                                     upd::twos_complement);
+
 extern "C" void setUp() {}
 
 extern "C" void tearDown() { reply_hook = {}; }
@@ -283,6 +317,107 @@ static void buffered_dispatcher_DO_use_parenthesis_operator() {
   TEST_ASSERT_EQUAL(64, k.read_from(kbuf));
 }
 
+static void buffered_dispatcher_DO_use_parenthesis_operator_on_vectors_EXPECT_same_result_as_byte_per_byte() {
+  using namespace upd;
+
+  auto k = kring.get(UPD_CTREF(identity));
+  auto dis = make_double_buffered_dispatcher(kring, policy::any_callback);
+  std::vector<byte_t> input(k.payload_length), output(sizeof(std::int64_t));
+
+  k(-0x123456789).write_to(input.begin());
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, dis(input.cbegin(), output.begin()));
+  TEST_ASSERT_FALSE(dis.is_loaded());
+  TEST_ASSERT_EQUAL_INT64(-0x123456789, k.read_from(output.cbegin()));
+
+  std::list<byte_t> input_list{input.begin(), input.end()};
+  std::vector<byte_t> byte_per_byte;
+  dis.read_from(input_list.cbegin());
+  dis.write_to(std::back_inserter(byte_per_byte));
+  TEST_ASSERT_TRUE(byte_per_byte == output);
+}
+
+static void buffered_dispatcher_DO_put_several_packets_at_once_EXPECT_packets_resolved_until_output_loaded() {
+  using namespace upd;
+
+  upd::byte_t buf[64], *ptr = buf;
+  auto k_identity = kring.get(UPD_CTREF(identity));
+  auto k_void = kring.get(UPD_CTREF(void_procedure));
+  auto dis = make_double_buffered_dispatcher(kring, policy::weak_reference);
+
+  k_void().write_to(ptr);
+  ptr += k_void.payload_length;
+  *ptr++ = 0xff;
+  k_identity(64).write_to(ptr);
+  ptr += k_identity.payload_length;
+  k_void().write_to(ptr);
+  ptr += k_void.payload_length;
+
+  auto size = static_cast<std::size_t>(ptr - buf);
+  auto result = dis.put(buf, size);
+
+  TEST_ASSERT_EQUAL_UINT(size - k_void.payload_length, result.consumed);
+  TEST_ASSERT_EQUAL_UINT(2, result.resolved);
+  TEST_ASSERT_EQUAL_UINT(1, result.dropped);
+  TEST_ASSERT_TRUE(dis.is_loaded());
+  TEST_ASSERT_EQUAL(64, k_identity.read_from([&]() { return dis.get(); }));
+
+  result = dis.put(buf + result.consumed, size - result.consumed);
+
+  TEST_ASSERT_EQUAL_UINT(k_void.payload_length, result.consumed);
+  TEST_ASSERT_EQUAL_UINT(1, result.resolved);
+  TEST_ASSERT_EQUAL_UINT(0, result.dropped);
+  TEST_ASSERT_FALSE(dis.is_loaded());
+}
+
+static void buffered_dispatcher_DO_call_action_taking_a_view_EXPECT_view_bound_to_the_payload() {
+  using namespace upd;
+
+  upd::byte_t kbuf[64];
+  auto k = view_kring.get(UPD_CTREF(sum));
+  auto dis = make_single_buffered_dispatcher(view_kring, policy::weak_reference);
+
+  static_assert(k.payload_length == sizeof(decltype(dis)::index_t) + sizeof(int) + sizeof(std::int64_t), "");
+
+  k(-21, 64).write_to(kbuf);
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, dis(kbuf, kbuf));
+  TEST_ASSERT_EQUAL_INT64(43, k.read_from(kbuf));
+}
+
+static void buffered_dispatcher_DO_call_action_writing_into_output_view_EXPECT_result_in_output_buffer() {
+  using namespace upd;
+
+  upd::byte_t kbuf[64];
+  auto k = output_view_kring.get(UPD_CTREF(read_calibration_table));
+  auto dis = make_double_buffered_dispatcher(output_view_kring, policy::weak_reference);
+
+  static_assert(std::is_same<decltype(k)::signature_t, std::array<std::uint16_t, 8>()>::value, "");
+  static_assert(dis.output_buffer_size == sizeof calibration_table, "");
+
+  k().write_to(kbuf);
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, dis(kbuf, kbuf));
+  TEST_ASSERT_TRUE(k.read_from(kbuf) == (std::array<std::uint16_t, 8>{0x0123,
+                                                                      0x4567,
+                                                                      0x89ab,
+                                                                      0xcdef,
+                                                                      0xfedc,
+                                                                      0xba98,
+                                                                      0x7654,
+                                                                      0x3210}));
+}
+
+static void buffered_dispatcher_DO_call_lazy_action_writing_into_output_view_EXPECT_payload_not_overwritten() {
+  using namespace upd;
+
+  upd::byte_t kbuf[64];
+  std::int16_t values[] = {-1, 2, -3, 4, -5, 6, -7, 8};
+  auto k = output_view_kring.get(UPD_CTREF(increment_all));
+  auto dis = make_single_buffered_dispatcher(output_view_kring, policy::weak_reference);
+
+  k(values).write_to(kbuf);
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, dis(kbuf, kbuf));
+  TEST_ASSERT_TRUE(k.read_from(kbuf) == (std::array<std::int16_t, 8>{0, 3, -2, 5, -4, 7, -6, 9}));
+}
+
 int main() {
   using namespace upd;
 
@@ -299,5 +434,10 @@ int main() {
   RUN_TEST(buffered_dispatcher_DO_create_double_buffered_dispatcher_with_no_storage_action);
   RUN_TEST(buffered_dispatcher_DO_reply);
   RUN_TEST(buffered_dispatcher_DO_use_parenthesis_operator);
+  RUN_TEST(buffered_dispatcher_DO_use_parenthesis_operator_on_vectors_EXPECT_same_result_as_byte_per_byte);
+  RUN_TEST(buffered_dispatcher_DO_put_several_packets_at_once_EXPECT_packets_resolved_until_output_loaded);
+  RUN_TEST(buffered_dispatcher_DO_call_action_taking_a_view_EXPECT_view_bound_to_the_payload);
+  RUN_TEST(buffered_dispatcher_DO_call_action_writing_into_output_view_EXPECT_result_in_output_buffer);
+  RUN_TEST(buffered_dispatcher_DO_call_lazy_action_writing_into_output_view_EXPECT_payload_not_overwritten);
   return UNITY_END();
 }
@@ -1,3 +1,5 @@
+#include <vector>
+
 #include <upd/dispatcher.hpp>
 #include <upd/format.hpp>
 #include <upd/keyring.hpp>
@@ -10,6 +12,11 @@ int get_16() { return 16; }
 int get_32() { return 32; }
 int identity(int x) { return x; }
 
+void square(int x,
+            upd::tuple_view<upd::byte_t *, upd::endianess::BIG, upd::signed_mode::ONES_COMPLEMENT, long long> out) {
+  out.set<0>(static_cast<long long>(x) * x);
+}
+
 constexpr auto ftor_list = upd::make_flist(UPD_CTREF(get_8), UPD_CTREF(get_16), UPD_CTREF(get_32), UPD_CTREF(identity));
 
 static void dispatcher_DO_call_action_EXPECT_calling_correct_action() {
@@ -99,6 +106,80 @@ static void dispatcher_DO_replace_a_no_storage_action_EXPECT_changed_action() {
   TEST_ASSERT_EQUAL_UINT(32, output.get<0>());
 }
 
+static void dispatcher_DO_get_action_sizes_EXPECT_sizes_from_signatures() {
+  using namespace upd;
+
+  constexpr auto kring = make_keyring(ftor_list, little_endian, twos_complement);
+  using dispatcher_t = decltype(make_dispatcher(kring, policy::weak_reference));
+
+  static_assert(sizeof(dispatcher_t::action_t) == sizeof(void *), "");
+  TEST_ASSERT_EQUAL_UINT(0, dispatcher_t::input_size(0));
+  TEST_ASSERT_EQUAL_UINT(sizeof(int), dispatcher_t::input_size(3));
+  TEST_ASSERT_EQUAL_UINT(sizeof(int), dispatcher_t::output_size(2));
+}
+
+static void dispatcher_DO_dispatch_batch_EXPECT_results_appended_and_entries_filled() {
+  using namespace upd;
+
+  constexpr auto kring = make_keyring(ftor_list, little_endian, twos_complement);
+  auto dispatcher = make_dispatcher(kring, policy::weak_reference);
+  auto input = upd::make_tuple(little_endian,
+                               twos_complement,
+                               uint8_t{0},
+                               uint8_t{0xff},
+                               uint8_t{3},
+                               int{64},
+                               uint8_t{2},
+                               uint8_t{3});
+  auto output = upd::make_tuple<int, int>(little_endian, twos_complement);
+  batch_entry entries[8];
+
+  auto result = dispatcher.dispatch_batch(input.begin(), input.size, output.begin(), output.size, entries, 8);
+
+  TEST_ASSERT_EQUAL_UINT(3, result.count);
+  TEST_ASSERT_EQUAL_UINT(3 * sizeof(uint8_t) + sizeof(int), result.consumed);
+  TEST_ASSERT_EQUAL_UINT(2 * sizeof(int), result.written);
+  TEST_ASSERT_EQUAL_INT(8, output.get<0>());
+  TEST_ASSERT_EQUAL_INT(64, output.get<1>());
+  TEST_ASSERT_TRUE(entries[0].status == packet_status::RESOLVED_PACKET);
+  TEST_ASSERT_TRUE(entries[1].status == packet_status::DROPPED_PACKET);
+  TEST_ASSERT_TRUE(entries[2].status == packet_status::RESOLVED_PACKET);
+  TEST_ASSERT_EQUAL_UINT(sizeof(int), entries[2].offset);
+  TEST_ASSERT_EQUAL_UINT(sizeof(int), entries[2].size);
+}
+
+static void dispatcher_DO_call_action_writing_into_output_view_EXPECT_result_written_to_output() {
+  using namespace upd;
+
+  constexpr auto kring = make_keyring(make_flist(UPD_CTREF(square)), big_endian, ones_complement);
+  auto k = kring.get(UPD_CTREF(square));
+  auto dispatcher = make_dispatcher(kring, policy::weak_reference);
+  byte_t buf[32], *ptr = buf;
+
+  static_assert(std::is_same<decltype(k)::signature_t, long long(int)>::value, "");
+  TEST_ASSERT_EQUAL_UINT(sizeof(long long), dispatcher.output_size(0));
+
+  k(-0xabcd).write_to(buf);
+  dispatcher([&]() { return *ptr++; }, [&](byte_t byte) { *ptr++ = byte; });
+
+  TEST_ASSERT_EQUAL_UINT(k.payload_length + sizeof(long long), ptr - buf);
+  TEST_ASSERT_EQUAL_INT64(0xabcdll * 0xabcd, k.read_from(buf + k.payload_length));
+}
+
+static void dispatcher_DO_call_action_on_vectors_EXPECT_result_written_to_output_vector() {
+  using namespace upd;
+
+  constexpr auto kring = make_keyring(ftor_list, little_endian, twos_complement);
+  auto dispatcher = make_dispatcher(kring, policy::any_callback);
+  auto k = kring.get(UPD_CTREF(identity));
+  std::vector<byte_t> input(k.payload_length), output(sizeof(int));
+
+  k(-0x1234).write_to(input.begin());
+
+  TEST_ASSERT_EQUAL_UINT(3, dispatcher(input.cbegin(), output.begin()));
+  TEST_ASSERT_EQUAL_INT(-0x1234, k.read_from(output.cbegin()));
+}
+
 int main() {
   using namespace upd;
 
@@ -108,5 +189,9 @@ int main() {
   RUN_TEST(dispatcher_DO_call_no_storage_action_EXPECT_correct_behavior);
   RUN_TEST(dispatcher_DO_replace_an_action_EXPECT_changed_action);
   RUN_TEST(dispatcher_DO_replace_a_no_storage_action_EXPECT_changed_action);
+  RUN_TEST(dispatcher_DO_get_action_sizes_EXPECT_sizes_from_signatures);
+  RUN_TEST(dispatcher_DO_dispatch_batch_EXPECT_results_appended_and_entries_filled);
+  RUN_TEST(dispatcher_DO_call_action_writing_into_output_view_EXPECT_result_written_to_output);
+  RUN_TEST(dispatcher_DO_call_action_on_vectors_EXPECT_result_written_to_output_vector);
   return UNITY_END();
 }
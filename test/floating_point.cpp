@@ -0,0 +1,132 @@
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include <upd/dispatcher.hpp>
+#include <upd/fixed.hpp>
+#include <upd/half.hpp>
+#include <upd/keyring.hpp>
+#include <upd/tuple.hpp>
+
+#include "utility.hpp"
+
+using centi_t = upd::fixed<std::int16_t, 100>;
+
+double move(float distance, upd::half speed, centi_t ratio) { return distance * speed * ratio; }
+
+constexpr auto kring = upd::make_keyring(upd::make_flist(UPD_CTREF(move)), upd::little_endian, upd::twos_complement);
+
+template<typename T, typename Word>
+static Word bits_of(T value) {
+  Word retval;
+  std::memcpy(&retval, &value, sizeof retval);
+  return retval;
+}
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void floating_point_DO_serialize_value_EXPECT_ieee754_representation() {
+  using namespace upd;
+
+  auto t = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, 1.5f, -0.1, half{-2.0f}, centi_t{-1.5});
+  auto is_little = Endianess == endianess::LITTLE;
+
+  TEST_ASSERT_EQUAL_UINT(4 + 8 + 2 + 2, t.size);
+  TEST_ASSERT_EQUAL_HEX8(0x3f, t.begin()[is_little ? 3 : 0]);
+  TEST_ASSERT_EQUAL_HEX8(0xc0, t.begin()[is_little ? 2 : 1]);
+  TEST_ASSERT_EQUAL_HEX8(0xbf, t.begin()[is_little ? 11 : 4]);
+  TEST_ASSERT_EQUAL_HEX8(0xc0, t.begin()[is_little ? 13 : 12]);
+
+  TEST_ASSERT_TRUE(1.5f == t.template get<0>());
+  TEST_ASSERT_TRUE(-0.1 == t.template get<1>());
+  TEST_ASSERT_TRUE(-2.0f == t.template get<2>());
+  TEST_ASSERT_EQUAL_INT16(-150, t.template get<3>().representation());
+}
+
+MAKE_MULTIOPT(floating_point_DO_serialize_value_EXPECT_ieee754_representation)
+
+static void floating_point_DO_encode_without_native_representation_EXPECT_same_bits() {
+  using namespace upd;
+
+  const float floats[] = {0.0f,
+                          -0.0f,
+                          1.0f,
+                          -3.14159f,
+                          std::numeric_limits<float>::max(),
+                          std::numeric_limits<float>::min(),
+                          std::numeric_limits<float>::denorm_min(),
+                          -std::numeric_limits<float>::infinity()};
+  for (auto x : floats) {
+    TEST_ASSERT_EQUAL_HEX32((bits_of<float, std::uint32_t>(x)), detail::encode_binary<4>(x));
+    TEST_ASSERT_TRUE(x == detail::decode_binary<4>(bits_of<float, std::uint32_t>(x)));
+  }
+
+  const double doubles[] = {1e-310, -2.5e300, 0.1, std::numeric_limits<double>::max()};
+  for (auto x : doubles) {
+    TEST_ASSERT_TRUE((bits_of<double, std::uint64_t>(x)) == detail::encode_binary<8>(x));
+    TEST_ASSERT_TRUE(x == detail::decode_binary<8>(bits_of<double, std::uint64_t>(x)));
+  }
+
+  auto nan = detail::encode_binary<4>(std::numeric_limits<float>::quiet_NaN());
+  TEST_ASSERT_TRUE(std::isnan(detail::decode_binary<4>(nan)));
+}
+
+static void floating_point_DO_make_half_values_EXPECT_rounded_binary16() {
+  using namespace upd;
+
+  const float values[] = {1.0f, -2.0f, 65504.0f, 65520.0f, 0.1f, 1.0f / 3, 1.0f + 1.0f / 2048, 1.0f + 3.0f / 2048,
+                          5.960464477539063e-08f};
+  const std::uint16_t expected[] = {0x3c00, 0xc000, 0x7bff, 0x7c00, 0x2e66, 0x3555, 0x3c00, 0x3c02, 0x0001};
+
+  for (std::size_t i = 0; i < sizeof values / sizeof *values; i++) {
+    TEST_ASSERT_EQUAL_HEX16(expected[i], half{values[i]}.representation());
+    TEST_ASSERT_EQUAL_HEX16(expected[i], detail::encode_binary<2>(values[i]));
+  }
+
+  TEST_ASSERT_TRUE(0.0999755859375f == half{0.1f});
+  TEST_ASSERT_TRUE(std::numeric_limits<float>::infinity() == half::from_representation(0x7c00));
+}
+
+static void floating_point_DO_make_fixed_values_EXPECT_rounded_and_saturated() {
+  TEST_ASSERT_EQUAL_INT16(123, centi_t{1.234}.representation());
+  TEST_ASSERT_EQUAL_INT16(-124, centi_t{-1.236}.representation());
+  TEST_ASSERT_EQUAL_INT16(32767, centi_t{1000.0}.representation());
+  TEST_ASSERT_EQUAL_INT16(-32768, centi_t{-1000.0}.representation());
+  TEST_ASSERT_EQUAL_INT16(0, centi_t{std::numeric_limits<double>::quiet_NaN()}.representation());
+  TEST_ASSERT_TRUE(2.5f == centi_t::from_representation(250));
+}
+
+static void floating_point_DO_make_wide_fixed_values_EXPECT_resolution_kept() {
+  using milli_t = upd::fixed<std::int32_t, 1000>;
+  using micro_t = upd::fixed<long long, 1000000>;
+
+  TEST_ASSERT_EQUAL_INT32(16777217, milli_t{16777.217}.representation());
+  TEST_ASSERT_TRUE(16777.217 == milli_t{16777.217}.value());
+  TEST_ASSERT_TRUE(1234567.654321 == micro_t{1234567.654321});
+}
+
+static void floating_point_DO_call_callback_EXPECT_compact_request() {
+  using namespace upd;
+
+  auto k = kring.get(UPD_CTREF(move));
+  auto dis = make_dispatcher(kring, policy::any_callback);
+  byte_t packet[k.payload_length], response[sizeof(double)], *ptr = packet;
+
+  TEST_ASSERT_EQUAL_UINT(1 + 4 + 2 + 2, k.payload_length);
+  k.encode_into(packet, 3.0f, half{0.5f}, centi_t{-2.0});
+
+  std::size_t written = 0;
+  dis([&]() { return *ptr++; }, [&](byte_t byte) { response[written++] = byte; });
+  TEST_ASSERT_EQUAL_UINT(sizeof response, written);
+  TEST_ASSERT_TRUE(-3.0 == k.read_from(response));
+}
+
+int main() {
+  UNITY_BEGIN();
+  floating_point_DO_serialize_value_EXPECT_ieee754_representation_multiopt(every_options);
+  RUN_TEST(floating_point_DO_encode_without_native_representation_EXPECT_same_bits);
+  RUN_TEST(floating_point_DO_make_half_values_EXPECT_rounded_binary16);
+  RUN_TEST(floating_point_DO_make_fixed_values_EXPECT_rounded_and_saturated);
+  RUN_TEST(floating_point_DO_make_wide_fixed_values_EXPECT_resolution_kept);
+  RUN_TEST(floating_point_DO_call_callback_EXPECT_compact_request);
+  return UNITY_END();
+}
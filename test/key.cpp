@@ -1,3 +1,8 @@
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <vector>
+
 #include <upd/key.hpp>
 #include <upd/keyring.hpp>
 #include <upd/typelist.hpp>
@@ -129,6 +134,71 @@ static void key_base_DO_hook_a_callback_EXPECT_callback_receiving_correct_argume
   k.with_hook([](int value) { TEST_ASSERT_EQUAL_INT(64, value); })([&]() { return t[i++]; });
 }
 
+static void key_base_DO_write_to_and_read_from_a_vector_EXPECT_same_bytes_as_byte_per_byte() {
+  using namespace upd;
+
+  constexpr auto k = kring.get(UPD_CTREF(big_function));
+  int array[] = {-1, 2, -3, 4, -5, 6, -7, 8};
+  std::vector<byte_t> vector(k.payload_length);
+  std::list<byte_t> list;
+
+  static_assert(detail::is_contiguous_byte_iterator<std::vector<byte_t>::iterator>::value, "");
+  k(64, array, 'a').write_to(vector.begin());
+  k(64, array, 'a').write_to(std::back_inserter(list));
+
+  TEST_ASSERT_TRUE(std::equal(list.begin(), list.end(), vector.begin()));
+  TEST_ASSERT_EQUAL_INT(-0xabc, k.read_from(make_tuple(little_endian, twos_complement, int{-0xabc}).begin()));
+  TEST_ASSERT_EQUAL_INT(-0xabc, k.read_from(std::vector<byte_t>{0x44, 0xf5, 0xff, 0xff}.cbegin()));
+}
+
+static void key_base_DO_write_request_without_intermediate_storage_EXPECT_same_bytes_as_serialized_message() {
+  using namespace upd;
+
+  constexpr auto k = kring.get(UPD_CTREF(big_function));
+  int array[] = {-1, 2, -3, 4, -5, 6, -7, 8};
+  byte_t expected[k.payload_length], encoded[k.payload_length], written[k.payload_length];
+  std::list<byte_t> list;
+
+  k(64, array, 'a').write_to([&](byte_t byte) { list.push_back(byte); });
+  std::copy(list.begin(), list.end(), expected);
+  list.clear();
+
+  k.encode_into(encoded, 64, array, 'a');
+  byte_t *ptr = written;
+  k.write([&](byte_t byte) { *ptr++ = byte; }, 64, array, 'a');
+  k.write(std::back_inserter(list), 64, array, 'a');
+
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, encoded, k.payload_length);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, written, k.payload_length);
+  TEST_ASSERT_EQUAL_UINT(k.payload_length, ptr - written);
+  TEST_ASSERT_TRUE(std::equal(list.begin(), list.end(), expected));
+
+  constexpr auto object_key = kring.get(UPD_CTREF(function_object));
+  byte_t object_expected[object_key.payload_length], object_written[object_key.payload_length];
+  object_key(object_t{1, 2, 3}).write_to(object_expected);
+  object_key.write(object_written, object_t{1, 2, 3});
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(object_expected, object_written, object_key.payload_length);
+}
+
+#if __cplusplus >= 201703L
+static void key_base_DO_prebuild_request_EXPECT_same_bytes_as_runtime_serialization() {
+  using namespace upd;
+
+  constexpr auto ones_kring = make_keyring(list, big_endian, ones_complement);
+  constexpr auto k = ones_kring.get(UPD_CTREF(big_function));
+  constexpr int array[] = {-1, 2, -3, 4, -5, 6, -7, 8};
+  constexpr auto packet = prebuild(k, -64, array, 'a');
+  static constexpr auto rom_packet = k.prebuild(0x7fffffff, array, -128);
+  byte_t expected[k.payload_length];
+
+  static_assert(packet.size() == k.payload_length);
+  k(-64, array, 'a').write_to(expected);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, packet.data(), k.payload_length);
+  k(0x7fffffff, array, -128).write_to(expected);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, rom_packet.data(), k.payload_length);
+}
+#endif // __cplusplus >= 201703L
+
 int main() {
   using namespace upd;
 
@@ -140,5 +210,10 @@ int main() {
   RUN_TEST(key_base_DO_create_key_from_ftor_signature_EXPECT_key_holding_ftor_signature);
   RUN_TEST(key_base_DO_create_key_from_function_using_user_extended_type_EXPECT_correct_behaviour);
   RUN_TEST(key_base_DO_hook_a_callback_EXPECT_callback_receiving_correct_argument);
+  RUN_TEST(key_base_DO_write_to_and_read_from_a_vector_EXPECT_same_bytes_as_byte_per_byte);
+  RUN_TEST(key_base_DO_write_request_without_intermediate_storage_EXPECT_same_bytes_as_serialized_message);
+#if __cplusplus >= 201703L
+  RUN_TEST(key_base_DO_prebuild_request_EXPECT_same_bytes_as_runtime_serialization);
+#endif // __cplusplus >= 201703L
   return UNITY_END();
 }
@@ -0,0 +1,89 @@
+#include <cstdint>
+
+#include <upd/keyring.hpp>
+#include <upd/multi_session_dispatcher.hpp>
+#include <upd/unevaluated.hpp>
+
+#include "utility.hpp"
+
+std::int32_t identity(std::int32_t x) { return x; }
+
+void void_procedure() {}
+
+constexpr auto kring = upd::make_keyring(
+    upd::make_flist(UPD_CTREF(identity), UPD_CTREF(void_procedure)), upd::little_endian, upd::twos_complement);
+
+using dispatcher_t = upd::dispatcher<decltype(kring), upd::action_features::WEAK_REFERENCE>;
+
+static void multi_session_dispatcher_DO_put_complete_packets_EXPECT_no_buffer_borrowed() {
+  using namespace upd;
+
+  upd::byte_t buf[32], obuf[8];
+  std::size_t j = 0;
+  auto k = kring.get(UPD_CTREF(identity));
+  multi_session_dispatcher<dispatcher_t, 1> dis{kring, policy::weak_reference};
+  decltype(dis)::session s;
+
+  k(0x1234).write_to(buf);
+  k(0x5678).write_to(buf + k.payload_length);
+  auto result = dis.put(s, buf, 2 * k.payload_length, [&](upd::byte_t byte) { obuf[j++] = byte; });
+
+  TEST_ASSERT_EQUAL_UINT(2 * k.payload_length, result.consumed);
+  TEST_ASSERT_EQUAL_UINT(2, result.resolved);
+  TEST_ASSERT_EQUAL_UINT(1, dis.available_buffers());
+  TEST_ASSERT_EQUAL(0x1234, k.read_from(obuf));
+  TEST_ASSERT_EQUAL(0x5678, k.read_from(obuf + sizeof(std::int32_t)));
+}
+
+static void multi_session_dispatcher_DO_interleave_split_packets_EXPECT_sessions_independent() {
+  using namespace upd;
+
+  upd::byte_t buf1[8], buf2[8];
+  std::uint32_t result1 = 0, result2 = 0;
+  auto k = kring.get(UPD_CTREF(identity));
+  multi_session_dispatcher<dispatcher_t, 2> dis{kring, policy::weak_reference};
+  decltype(dis)::session s1, s2;
+
+  k(111).write_to(buf1);
+  k(222).write_to(buf2);
+  auto into = [](std::uint32_t &result) {
+    return [&](upd::byte_t byte) { result = result >> 8 | std::uint32_t{byte} << 24; };
+  };
+
+  for (std::size_t i = 0; i < k.payload_length; ++i) {
+    TEST_ASSERT_EQUAL_UINT(1, dis.put(s1, buf1 + i, 1, into(result1)).consumed);
+    TEST_ASSERT_EQUAL_UINT(1, dis.put(s2, buf2 + i, 1, into(result2)).consumed);
+  }
+
+  TEST_ASSERT_EQUAL_UINT(111, result1);
+  TEST_ASSERT_EQUAL_UINT(222, result2);
+  TEST_ASSERT_FALSE(s1.is_loading());
+  TEST_ASSERT_EQUAL_UINT(2, dis.available_buffers());
+}
+
+static void multi_session_dispatcher_DO_exhaust_pool_EXPECT_bytes_not_consumed() {
+  using namespace upd;
+
+  upd::byte_t buf[8];
+  auto k = kring.get(UPD_CTREF(identity));
+  multi_session_dispatcher<dispatcher_t, 1> dis{kring, policy::weak_reference};
+  decltype(dis)::session s1, s2;
+
+  k(0).write_to(buf);
+  TEST_ASSERT_EQUAL_UINT(2, dis.put(s1, buf, 2, [](upd::byte_t) {}).consumed);
+  TEST_ASSERT_EQUAL_UINT(0, dis.put(s2, buf, 2, [](upd::byte_t) {}).consumed);
+
+  dis.close(s1);
+  TEST_ASSERT_EQUAL_UINT(2, dis.put(s2, buf, 2, [](upd::byte_t) {}).consumed);
+  TEST_ASSERT_TRUE(s2.is_loading());
+}
+
+int main() {
+  using namespace upd;
+
+  UNITY_BEGIN();
+  RUN_TEST(multi_session_dispatcher_DO_put_complete_packets_EXPECT_no_buffer_borrowed);
+  RUN_TEST(multi_session_dispatcher_DO_interleave_split_packets_EXPECT_sessions_independent);
+  RUN_TEST(multi_session_dispatcher_DO_exhaust_pool_EXPECT_bytes_not_consumed);
+  return UNITY_END();
+}
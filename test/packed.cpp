@@ -0,0 +1,112 @@
+#include <cstdint>
+
+#include <upd/dispatcher.hpp>
+#include <upd/keyring.hpp>
+#include <upd/packed.hpp>
+#include <upd/tuple.hpp>
+
+#include "utility.hpp"
+
+enum class mode : std::uint8_t { OFF, ON, BLINK, PULSE };
+
+using status_t = upd::packed<bool, upd::bits<2, mode>, upd::bits<5, std::int8_t>, upd::bits<9>>;
+
+upd::flags<16> toggle_lights(upd::flags<16> lights, upd::packed<upd::bits<4>> index) {
+  switch (index.get<0>()) {
+  case 0:
+    lights.set<0>(!lights.get<0>());
+    break;
+  case 15:
+    lights.set<15>(!lights.get<15>());
+    break;
+  }
+
+  return lights;
+}
+
+constexpr auto kring =
+    upd::make_keyring(upd::make_flist(UPD_CTREF(toggle_lights)), upd::little_endian, upd::twos_complement);
+
+static void packed_DO_set_fields_EXPECT_same_values_and_minimal_size() {
+  status_t status{true, mode::PULSE, -16, 300};
+
+  TEST_ASSERT_EQUAL_UINT(17, status_t::bit_count);
+  TEST_ASSERT_EQUAL_UINT(3, sizeof(status_t));
+  TEST_ASSERT_TRUE(status.get<0>());
+  TEST_ASSERT_TRUE(mode::PULSE == status.get<1>());
+  TEST_ASSERT_EQUAL_INT8(-16, status.get<2>());
+  TEST_ASSERT_EQUAL_UINT16(300, status.get<3>());
+
+  status.set<1>(mode::ON);
+  status.set<2>(15);
+  TEST_ASSERT_TRUE(status.get<0>());
+  TEST_ASSERT_TRUE(mode::ON == status.get<1>());
+  TEST_ASSERT_EQUAL_INT8(15, status.get<2>());
+  TEST_ASSERT_EQUAL_UINT16(300, status.get<3>());
+}
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void packed_DO_serialize_fields_EXPECT_bits_laid_out_from_least_significant() {
+  using namespace upd;
+
+  auto t = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, status_t{true, mode::BLINK, -1, 0x1ff},
+                      std::uint8_t{0xaa});
+
+  TEST_ASSERT_EQUAL_UINT(4, t.size);
+  TEST_ASSERT_EQUAL_HEX8(0xfd, t.begin()[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xff, t.begin()[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x01, t.begin()[2]);
+  TEST_ASSERT_EQUAL_HEX8(0xaa, t.begin()[3]);
+  TEST_ASSERT_EQUAL_INT8(-1, t.template get<0>().template get<2>());
+}
+
+MAKE_MULTIOPT(packed_DO_serialize_fields_EXPECT_bits_laid_out_from_least_significant)
+
+static void packed_DO_write_full_width_fields_EXPECT_neighbours_untouched() {
+  using wide_t = upd::packed<bool, upd::bits<64>, upd::bits<64, std::int64_t>, bool>;
+  wide_t wide{true, 0x8000000000000001, -2, true};
+
+  TEST_ASSERT_EQUAL_UINT(17, sizeof(wide_t));
+  TEST_ASSERT_TRUE(wide.get<0>());
+  TEST_ASSERT_TRUE(0x8000000000000001 == wide.get<1>());
+  TEST_ASSERT_EQUAL_INT64(-2, wide.get<2>());
+  TEST_ASSERT_TRUE(wide.get<3>());
+
+  wide.set<1>(0);
+  TEST_ASSERT_TRUE(wide.get<0>());
+  TEST_ASSERT_EQUAL_INT64(-2, wide.get<2>());
+}
+
+static void packed_DO_send_flags_EXPECT_two_bytes_per_sixteen_booleans() {
+  using namespace upd;
+
+  auto k = kring.get(UPD_CTREF(toggle_lights));
+  auto dis = make_dispatcher(kring, policy::any_callback);
+  byte_t packet[k.payload_length], response[sizeof(flags<16>)], *ptr = packet;
+
+  TEST_ASSERT_EQUAL_UINT(1 + 2 + 1, k.payload_length);
+
+  flags<16> lights;
+  lights.set<3>(true);
+  k.encode_into(packet, lights, packed<bits<4>>{15});
+
+  std::size_t written = 0;
+  dis([&]() { return *ptr++; }, [&](byte_t byte) { response[written++] = byte; });
+  TEST_ASSERT_EQUAL_UINT(sizeof response, written);
+
+  auto result = k.read_from(response);
+  TEST_ASSERT_TRUE(result.get<3>());
+  TEST_ASSERT_TRUE(result.get<15>());
+  TEST_ASSERT_FALSE(result.get<0>());
+  TEST_ASSERT_EQUAL_HEX8(0x08, response[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x80, response[1]);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(packed_DO_set_fields_EXPECT_same_values_and_minimal_size);
+  packed_DO_serialize_fields_EXPECT_bits_laid_out_from_least_significant_multiopt(every_options);
+  RUN_TEST(packed_DO_write_full_width_fields_EXPECT_neighbours_untouched);
+  RUN_TEST(packed_DO_send_flags_EXPECT_two_bytes_per_sixteen_booleans);
+  return UNITY_END();
+}
@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <list>
+
+#include <upd/buffered_dispatcher.hpp>
+#include <upd/dispatcher.hpp>
+#include <upd/keyring.hpp>
+#include <upd/ranged.hpp>
+#include <upd/tuple.hpp>
+
+#include "utility.hpp"
+
+enum class gear : std::int32_t { REVERSE = -1, NEUTRAL, FIRST, SECOND, THIRD };
+
+template<>
+struct upd_enum_range<gear> {
+  constexpr static gear min = gear::REVERSE;
+  constexpr static gear max = gear::THIRD;
+};
+
+using speed_t = upd::ranged<int, -100, 100>;
+using altitude_t = upd::ranged<long, 1000, 1100>;
+
+altitude_t shift(gear g, speed_t speed) { return static_cast<long>(g) * 10 + speed + 1050; }
+
+int count_forward(upd::array_view<gear, 3, upd::endianess::LITTLE, upd::signed_mode::TWOS_COMPLEMENT> gears) {
+  return static_cast<int>(std::count_if(gears.begin(), gears.end(), [](gear g) { return g > gear::NEUTRAL; }));
+}
+
+altitude_t climb(std::uint16_t height) { return static_cast<long>(height); }
+
+constexpr auto kring = upd::make_keyring(upd::make_flist(UPD_CTREF(shift), UPD_CTREF(count_forward), UPD_CTREF(climb)),
+                                         upd::little_endian,
+                                         upd::twos_complement);
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void ranged_DO_serialize_value_EXPECT_offset_from_min_in_smallest_width() {
+  using namespace upd;
+
+  auto t = make_tuple(endianess_h<Endianess>{},
+                      signed_mode_h<Signed_Mode>{},
+                      ranged<int, 0, 1000>{1000},
+                      altitude_t{1042},
+                      gear::SECOND,
+                      speed_t{-100});
+
+  TEST_ASSERT_EQUAL_UINT(2 + 1 + 1 + 1, t.size);
+  TEST_ASSERT_EQUAL_HEX8(Endianess == endianess::LITTLE ? 0xe8 : 0x03, t.begin()[0]);
+  TEST_ASSERT_EQUAL_HEX8(42, t.begin()[2]);
+  TEST_ASSERT_EQUAL_HEX8(3, t.begin()[3]);
+  TEST_ASSERT_EQUAL_HEX8(0, t.begin()[4]);
+
+  TEST_ASSERT_EQUAL_INT(1000, t.template get<0>());
+  TEST_ASSERT_EQUAL_INT(1042, t.template get<1>().value());
+  TEST_ASSERT_TRUE(gear::SECOND == t.template get<2>());
+  TEST_ASSERT_EQUAL_INT(-100, t.template get<3>());
+}
+
+MAKE_MULTIOPT(ranged_DO_serialize_value_EXPECT_offset_from_min_in_smallest_width)
+
+static void ranged_DO_unserialize_value_out_of_range_EXPECT_detected() {
+  using namespace upd;
+
+  byte_t storage[] = {250};
+  auto value = detail::read_as<speed_t, endianess::LITTLE, signed_mode::TWOS_COMPLEMENT>(storage);
+  TEST_ASSERT_EQUAL_INT(150, value);
+  TEST_ASSERT_FALSE(value.in_range());
+  TEST_ASSERT_TRUE(speed_t{100}.in_range());
+  TEST_ASSERT_FALSE(speed_t{101}.in_range());
+
+  static_assert(speed_t{-100}.representation() == 0, "");
+  static_assert(speed_t::from_representation(200).value() == 100, "");
+}
+
+static void ranged_DO_serialize_through_iterator_EXPECT_only_representation_walked() {
+  using namespace upd;
+
+  std::list<byte_t> bytes;
+  detail::write_as<endianess::BIG, signed_mode::TWOS_COMPLEMENT>(gear::REVERSE, std::back_inserter(bytes));
+  bytes.push_back(0xff);
+  TEST_ASSERT_EQUAL_UINT(1 + 1, bytes.size());
+
+  auto g = detail::read_as<gear, endianess::BIG, signed_mode::TWOS_COMPLEMENT>(bytes.begin());
+  TEST_ASSERT_TRUE(gear::REVERSE == g);
+}
+
+static void ranged_DO_serialize_array_of_enumerations_EXPECT_each_element_compressed() {
+  using namespace upd;
+
+  const gear gears[] = {gear::FIRST, gear::REVERSE, gear::THIRD};
+  auto t = make_tuple(little_endian, twos_complement, gears, char{'x'});
+  TEST_ASSERT_EQUAL_UINT(3 + 1, t.size);
+  TEST_ASSERT_EQUAL_HEX8(2, t.begin()[0]);
+  TEST_ASSERT_EQUAL_HEX8(0, t.begin()[1]);
+  TEST_ASSERT_EQUAL_HEX8(4, t.begin()[2]);
+  TEST_ASSERT_EQUAL_HEX8('x', t.begin()[3]);
+  TEST_ASSERT_TRUE(std::equal(std::begin(gears), std::end(gears), t.template get<0>().begin()));
+
+  std::list<byte_t> bytes;
+  detail::write_as<endianess::BIG, signed_mode::TWOS_COMPLEMENT>(gears, std::back_inserter(bytes));
+  TEST_ASSERT_EQUAL_UINT(3, bytes.size());
+  auto array = detail::read_as<std::array<gear, 3>, endianess::BIG, signed_mode::TWOS_COMPLEMENT>(bytes.begin());
+  TEST_ASSERT_TRUE(std::equal(std::begin(gears), std::end(gears), array.begin()));
+
+  auto k = kring.get(UPD_CTREF(count_forward));
+  auto dis = make_dispatcher(kring, policy::any_callback);
+  byte_t packet[k.payload_length], response[sizeof(int)], *ptr = packet;
+  std::fill(std::begin(packet), std::end(packet), byte_t{0xaa});
+
+  TEST_ASSERT_EQUAL_UINT(1 + 3, k.payload_length);
+  TEST_ASSERT_EQUAL_UINT(1 + 3, k.encode_into(packet, gears));
+  TEST_ASSERT_EQUAL_HEX8(2, packet[1]);
+  TEST_ASSERT_EQUAL_HEX8(0, packet[2]);
+  TEST_ASSERT_EQUAL_HEX8(4, packet[3]);
+
+  const gear invalid_gears[] = {gear::FIRST, static_cast<gear>(7), gear::THIRD};
+  byte_t invalid_packet[k.payload_length];
+  TEST_ASSERT_EQUAL_UINT(1 + 3, k.encode_into(invalid_packet, invalid_gears));
+  TEST_ASSERT_EQUAL_HEX8(8, invalid_packet[2]);
+
+  std::size_t written = 0;
+  dis([&]() { return *ptr++; }, [&](byte_t byte) { response[written++] = byte; });
+  TEST_ASSERT_EQUAL_UINT(sizeof response, written);
+  TEST_ASSERT_EQUAL_INT(2, k.read_from(response));
+}
+
+static void ranged_DO_call_callback_EXPECT_compact_request() {
+  using namespace upd;
+
+  auto k = kring.get(UPD_CTREF(shift));
+  auto dis = make_dispatcher(kring, policy::any_callback);
+  byte_t packet[k.payload_length], response[1], *ptr = packet;
+
+  TEST_ASSERT_EQUAL_UINT(1 + 1 + 1, k.payload_length);
+  TEST_ASSERT_EQUAL_UINT(k.payload_length, k.encode_into(packet, gear::THIRD, -20));
+
+  std::size_t written = 0;
+  dis([&]() { return *ptr++; }, [&](byte_t byte) { response[written++] = byte; });
+  TEST_ASSERT_EQUAL_UINT(sizeof response, written);
+  TEST_ASSERT_EQUAL_INT(1060, k.read_from(response));
+}
+
+static void ranged_DO_send_value_out_of_range_EXPECT_full_length_request() {
+  using namespace upd;
+
+  auto k = kring.get(UPD_CTREF(shift));
+  byte_t encoded[k.payload_length], streamed[k.payload_length], message[k.payload_length], *ptr = streamed;
+
+  TEST_ASSERT_EQUAL_UINT(k.payload_length, k.encode_into(encoded, gear::FIRST, 101));
+  k.write([&](byte_t byte) { *ptr++ = byte; }, gear::FIRST, 101);
+  k(gear::FIRST, 101).write_to(message);
+
+  TEST_ASSERT_EQUAL_UINT(k.payload_length, ptr - streamed);
+  TEST_ASSERT_EQUAL_HEX8(201, encoded[2]);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(encoded, streamed, k.payload_length);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(encoded, message, k.payload_length);
+  TEST_ASSERT_FALSE(speed_t{101}.in_range());
+}
+
+static void ranged_DO_return_value_out_of_range_EXPECT_responses_in_step() {
+  using namespace upd;
+
+  auto k = kring.get(UPD_CTREF(climb));
+  auto dis = make_dispatcher(kring, policy::any_callback);
+  auto buffered_dis = make_single_buffered_dispatcher(kring, policy::any_callback);
+  byte_t packets[2 * k.payload_length], responses[2], *src = packets, *dest = responses;
+
+  k(2000).write_to(packets);
+  k(1100).write_to(packets + k.payload_length);
+
+  dis([&]() { return *src++; }, [&](byte_t byte) { *dest++ = byte; });
+  dis([&]() { return *src++; }, [&](byte_t byte) { *dest++ = byte; });
+  TEST_ASSERT_EQUAL_UINT(sizeof responses, dest - responses);
+  TEST_ASSERT_FALSE(k.read_from(responses).in_range());
+  TEST_ASSERT_EQUAL_INT(1100, k.read_from(responses + 1));
+
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, buffered_dis.read_from(packets));
+  TEST_ASSERT_TRUE(buffered_dis.is_loaded());
+  buffered_dis.write_to(responses);
+  TEST_ASSERT_FALSE(k.read_from(responses).in_range());
+}
+
+int main() {
+  UNITY_BEGIN();
+  ranged_DO_serialize_value_EXPECT_offset_from_min_in_smallest_width_multiopt(every_options);
+  RUN_TEST(ranged_DO_unserialize_value_out_of_range_EXPECT_detected);
+  RUN_TEST(ranged_DO_serialize_through_iterator_EXPECT_only_representation_walked);
+  RUN_TEST(ranged_DO_serialize_array_of_enumerations_EXPECT_each_element_compressed);
+  RUN_TEST(ranged_DO_call_callback_EXPECT_compact_request);
+  RUN_TEST(ranged_DO_send_value_out_of_range_EXPECT_full_length_request);
+  RUN_TEST(ranged_DO_return_value_out_of_range_EXPECT_responses_in_step);
+  return UNITY_END();
+}
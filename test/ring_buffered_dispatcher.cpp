@@ -0,0 +1,101 @@
+#include <cstdint>
+#include <thread>
+
+#include <upd/keyring.hpp>
+#include <upd/ring_buffered_dispatcher.hpp>
+#include <upd/unevaluated.hpp>
+
+#include "utility.hpp"
+
+std::int32_t identity(std::int32_t x) { return x; }
+
+void void_procedure() {}
+
+constexpr auto kring = upd::make_keyring(
+    upd::make_flist(UPD_CTREF(identity), UPD_CTREF(void_procedure)), upd::little_endian, upd::twos_complement);
+
+using dispatcher_t = upd::dispatcher<decltype(kring), upd::action_features::WEAK_REFERENCE>;
+
+static void ring_buffered_dispatcher_DO_put_then_poll_EXPECT_packets_resolved() {
+  using namespace upd;
+
+  upd::byte_t kbuf[16];
+  auto k = kring.get(UPD_CTREF(identity));
+  ring_buffered_dispatcher<dispatcher_t, 16> dis{kring, policy::weak_reference};
+
+  k(0x1234).write_to(kbuf);
+  TEST_ASSERT_EQUAL_UINT(k.payload_length, dis.put(kbuf, k.payload_length));
+  k(0x5678).write_to(kbuf);
+  TEST_ASSERT_EQUAL_UINT(k.payload_length, dis.put(kbuf, k.payload_length));
+
+  auto result = dis.poll();
+  TEST_ASSERT_EQUAL_UINT(k.payload_length, result.consumed);
+  TEST_ASSERT_EQUAL_UINT(1, result.resolved);
+  TEST_ASSERT_EQUAL(0x1234, k.read_from([&]() { return dis.get(); }));
+
+  result = dis.poll();
+  TEST_ASSERT_EQUAL_UINT(1, result.resolved);
+  TEST_ASSERT_EQUAL(0x5678, k.read_from([&]() { return dis.get(); }));
+  TEST_ASSERT_EQUAL_UINT(0, dis.poll().consumed);
+}
+
+static void ring_buffered_dispatcher_DO_put_into_full_ring_EXPECT_bytes_discarded() {
+  using namespace upd;
+
+  upd::byte_t bytes[8] = {1, 1, 1, 1, 1, 1, 1, 1};
+  ring_buffered_dispatcher<dispatcher_t, 8> dis{kring, policy::weak_reference};
+
+  TEST_ASSERT_EQUAL_UINT(8, dis.put(bytes, 8));
+  TEST_ASSERT_FALSE(dis.put(upd::byte_t{1}));
+}
+
+static void ring_buffered_dispatcher_DO_produce_and_consume_from_two_threads_EXPECT_every_packet_resolved() {
+  using namespace upd;
+
+  constexpr std::int32_t packet_count = 10000;
+  auto k = kring.get(UPD_CTREF(identity));
+  ring_buffered_dispatcher<dispatcher_t, 64> dis{kring, policy::weak_reference};
+
+  std::thread producer{[&]() {
+    upd::byte_t kbuf[16];
+    for (std::int32_t i = 0; i < packet_count; ++i) {
+      k(i).write_to(kbuf);
+      for (std::size_t sent = 0; sent < k.payload_length;)
+        sent += dis.put(kbuf + sent, k.payload_length - sent);
+    }
+  }};
+
+  std::int64_t sum = 0;
+  std::size_t resolved = 0;
+  upd::byte_t obuf[sizeof(std::int32_t)];
+  std::size_t obuf_size = 0;
+  while (resolved < packet_count) {
+    resolved += dis.poll([&](upd::byte_t byte) {
+      obuf[obuf_size++] = byte;
+      if (obuf_size == sizeof obuf) {
+        sum += k.read_from(obuf);
+        obuf_size = 0;
+      }
+    }).resolved;
+  }
+  dis.write_to([&](upd::byte_t byte) {
+    obuf[obuf_size++] = byte;
+    if (obuf_size == sizeof obuf) {
+      sum += k.read_from(obuf);
+      obuf_size = 0;
+    }
+  });
+
+  producer.join();
+  TEST_ASSERT_EQUAL_INT64(std::int64_t{packet_count} * (packet_count - 1) / 2, sum);
+}
+
+int main() {
+  using namespace upd;
+
+  UNITY_BEGIN();
+  RUN_TEST(ring_buffered_dispatcher_DO_put_then_poll_EXPECT_packets_resolved);
+  RUN_TEST(ring_buffered_dispatcher_DO_put_into_full_ring_EXPECT_bytes_discarded);
+  RUN_TEST(ring_buffered_dispatcher_DO_produce_and_consume_from_two_threads_EXPECT_every_packet_resolved);
+  return UNITY_END();
+}
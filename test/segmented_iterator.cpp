@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <cstdint>
+
+#include <upd/buffered_dispatcher.hpp>
+#include <upd/keyring.hpp>
+#include <upd/segmented_iterator.hpp>
+#include <upd/tuple.hpp>
+
+#include "utility.hpp"
+
+std::int64_t scale(std::int32_t x, std::int16_t factor) { return static_cast<std::int64_t>(x) * factor; }
+
+constexpr auto kring = upd::make_keyring(upd::make_flist(UPD_CTREF(scale)), upd::little_endian, upd::twos_complement);
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void segmented_iterator_DO_bind_view_across_wraparound_EXPECT_same_values_as_linear_storage() {
+  using namespace upd;
+
+  std::int16_t array[] = {-5, 6};
+  auto linear = make_tuple(
+      endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, std::int16_t{-2}, std::int32_t{-0x1234567}, array, 'z');
+
+  for (std::size_t offset = 0; offset < 16; offset++) {
+    byte_t ring[16] = {};
+    auto it = make_ring_iterator(ring, sizeof ring, offset);
+    auto view = make_view<std::int16_t, std::int32_t, std::int16_t[2], char>(
+        endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, it);
+
+    view = linear;
+    TEST_ASSERT_TRUE(std::equal(linear.begin(), linear.end(), view.begin()));
+
+    view.template set<1>(0x7654321);
+    auto cview = make_view<std::int16_t, std::int32_t, std::int16_t[2], char>(
+        endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, segmented_iterator<const byte_t>{it});
+    TEST_ASSERT_EQUAL_INT16(-2, cview.template get<0>());
+    TEST_ASSERT_EQUAL_INT32(0x7654321, cview.template get<1>());
+    TEST_ASSERT_EQUAL_INT16(-5, cview.template get<2>()[0]);
+    TEST_ASSERT_EQUAL_INT16(6, cview.template get<2>()[1]);
+    TEST_ASSERT_EQUAL_CHAR('z', cview.template get<3>());
+  }
+}
+
+MAKE_MULTIOPT(segmented_iterator_DO_bind_view_across_wraparound_EXPECT_same_values_as_linear_storage)
+
+static void segmented_iterator_DO_dispatch_packet_wrapping_around_ring_EXPECT_same_result_as_linear_packet() {
+  using namespace upd;
+
+  auto k = kring.get(UPD_CTREF(scale));
+  auto dis = make_single_buffered_dispatcher(kring, policy::any_callback);
+  byte_t packet[k.payload_length], ring[8], result[sizeof(std::int64_t)], linear_result[sizeof(std::int64_t)];
+
+  k(-100000, std::int16_t{300}).write_to(packet);
+  auto it = make_ring_iterator(ring, sizeof ring, 5);
+  std::copy(std::begin(packet), std::end(packet), it);
+
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, dis(segmented_iterator<const byte_t>{it}, result));
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, dis(packet, linear_result));
+  TEST_ASSERT_EQUAL_INT64(-30000000, k.read_from(result));
+  TEST_ASSERT_TRUE(std::equal(std::begin(result), std::end(result), std::begin(linear_result)));
+}
+
+int main() {
+  UNITY_BEGIN();
+  segmented_iterator_DO_bind_view_across_wraparound_EXPECT_same_values_as_linear_storage_multiopt(every_options);
+  RUN_TEST(segmented_iterator_DO_dispatch_packet_wrapping_around_ring_EXPECT_same_result_as_linear_packet);
+  return UNITY_END();
+}
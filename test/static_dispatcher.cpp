@@ -0,0 +1,91 @@
+#include <upd/format.hpp>
+#include <upd/keyring.hpp>
+#include <upd/static_dispatcher.hpp>
+#include <upd/unevaluated.hpp>
+
+#include "utility.hpp"
+
+int get_8() { return 8; }
+int get_16() { return 16; }
+int identity(int x) { return x; }
+int add(int x, short y) { return x + y; }
+
+struct {
+  long long operator()(char x) const { return x * 2; }
+} twice;
+
+constexpr auto ftor_list =
+    upd::make_flist(UPD_CTREF(get_8), UPD_CTREF(get_16), UPD_CTREF(identity), UPD_CTREF(add), UPD_CTREF(twice));
+
+static void static_dispatcher_DO_call_action_EXPECT_calling_correct_action() {
+  using namespace upd;
+
+  constexpr auto kring = make_keyring(ftor_list, little_endian, twos_complement);
+  auto dispatcher = make_static_dispatcher(kring);
+  auto input = upd::make_tuple(little_endian, twos_complement, uint8_t{2}, int{64});
+  auto output = upd::make_tuple<int>(little_endian, twos_complement);
+
+  std::size_t i = 0, j = 0;
+  auto index = dispatcher([&]() { return input[i++]; }, [&](upd::byte_t byte) {
+    if (j < output.size)
+      output[j] = byte;
+    j++;
+  });
+
+  TEST_ASSERT_EQUAL_UINT(2, index);
+  TEST_ASSERT_EQUAL_UINT(input.size, i);
+  TEST_ASSERT_EQUAL_UINT(output.size, j);
+  TEST_ASSERT_EQUAL_INT(64, output.get<0>());
+}
+
+static void static_dispatcher_DO_call_functor_EXPECT_calling_correct_action() {
+  using namespace upd;
+
+  constexpr auto kring = make_keyring(ftor_list, little_endian, twos_complement);
+  auto dispatcher = make_static_dispatcher(kring);
+  auto input = upd::make_tuple(little_endian, twos_complement, uint8_t{4}, char{21});
+  auto output = upd::make_tuple<long long>(little_endian, twos_complement);
+
+  dispatcher(input.begin(), output.begin());
+
+  TEST_ASSERT_EQUAL_INT(42, output.get<0>());
+}
+
+static void static_dispatcher_DO_call_on_contiguous_buffers_EXPECT_correct_output() {
+  using namespace upd;
+
+  constexpr auto kring = make_keyring(ftor_list, little_endian, twos_complement);
+  auto dispatcher = make_static_dispatcher(kring);
+  auto input = upd::make_tuple(little_endian, twos_complement, int{40}, short{2});
+  auto output = upd::make_tuple<int>(little_endian, twos_complement);
+
+  auto written = dispatcher.call(3, input.begin(), output.begin());
+
+  TEST_ASSERT_EQUAL_UINT(sizeof(int), written);
+  TEST_ASSERT_EQUAL_INT(42, output.get<0>());
+}
+
+static void static_dispatcher_DO_get_sizes_EXPECT_correct_sizes() {
+  using namespace upd;
+
+  constexpr auto kring = make_keyring(ftor_list, little_endian, twos_complement);
+  using dispatcher_t = decltype(make_static_dispatcher(kring));
+
+  TEST_ASSERT_EQUAL_UINT(0, dispatcher_t::input_size(0));
+  TEST_ASSERT_EQUAL_UINT(sizeof(int), dispatcher_t::input_size(2));
+  TEST_ASSERT_EQUAL_UINT(sizeof(int) + sizeof(short), dispatcher_t::input_size(3));
+  TEST_ASSERT_EQUAL_UINT(sizeof(char), dispatcher_t::input_size(4));
+  TEST_ASSERT_EQUAL_UINT(sizeof(int), dispatcher_t::output_size(1));
+  TEST_ASSERT_EQUAL_UINT(sizeof(long long), dispatcher_t::output_size(4));
+}
+
+int main() {
+  using namespace upd;
+
+  UNITY_BEGIN();
+  RUN_TEST(static_dispatcher_DO_call_action_EXPECT_calling_correct_action);
+  RUN_TEST(static_dispatcher_DO_call_functor_EXPECT_calling_correct_action);
+  RUN_TEST(static_dispatcher_DO_call_on_contiguous_buffers_EXPECT_correct_output);
+  RUN_TEST(static_dispatcher_DO_get_sizes_EXPECT_correct_sizes);
+  return UNITY_END();
+}
@@ -231,6 +231,19 @@ static void tuple_view_DO_iterate_subview_EXPECT_exact_subsequence() {
     TEST_ASSERT_EQUAL_UINT8(*e_seq++, byte);
 }
 
+static void tuple_DO_construct_uninitialized_tuple_EXPECT_values_from_copied_content() {
+  using namespace upd;
+
+  int array[] = {1, -2, 3};
+  auto source = make_tuple(little_endian, twos_complement, int16_t{-0x1234}, array, uint8_t{0xab});
+  tuple<endianess::LITTLE, signed_mode::TWOS_COMPLEMENT, int16_t, int[3], uint8_t> t{uninitialized};
+  std::copy(source.begin(), source.end(), t.begin());
+
+  TEST_ASSERT_EQUAL_INT16(-0x1234, t.get<0>());
+  TEST_ASSERT_EQUAL_INT_ARRAY(array, t.get<1>().data(), 3);
+  TEST_ASSERT_EQUAL_HEX8(0xab, t.get<2>());
+}
+
 static void tuple_DO_serialize_std_array() {
   using namespace upd;
 
@@ -240,12 +253,37 @@ static void tuple_DO_serialize_std_array() {
   TEST_ASSERT_EQUAL_INT_ARRAY(expected, get<0>(t).data(), 4);
 }
 
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+void tuple_DO_assign_tuple_EXPECT_same_values() {
+  using namespace upd;
+
+  using plan_t = typename tuple<Endianess, Signed_Mode, uint8_t, int16_t, int32_t[3], uint64_t>::plan_t;
+  static_assert(detail::at<typename plan_t::fields_t, 2>::offset == 3, "");
+  static_assert(detail::at<typename plan_t::fields_t, 3>::offset == 15, "");
+  static_assert(plan_t::size == 23, "");
+
+  int32_t array[] = {-1, 0x12345678, -0x1234567};
+  tuple<Endianess, Signed_Mode, uint8_t, int16_t, int32_t[3], uint64_t> source{0xab, -0xabc, array, 0x123456789abcdef};
+  tuple<Endianess, Signed_Mode, uint8_t, int16_t, int32_t[3], uint64_t> same_layout;
+  tuple<endianess::LITTLE, signed_mode::TWOS_COMPLEMENT, uint8_t, int16_t, int32_t[3], uint64_t> other_layout;
+
+  same_layout = source;
+  other_layout = source;
+
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(source.begin(), same_layout.begin(), source.size);
+  TEST_ASSERT_EQUAL_HEX8(0xab, other_layout.template get<0>());
+  TEST_ASSERT_EQUAL_INT16(-0xabc, other_layout.template get<1>());
+  TEST_ASSERT_EQUAL_INT32_ARRAY(array, other_layout.template get<2>().data(), 3);
+  TEST_ASSERT_EQUAL_HEX64(0x123456789abcdef, other_layout.template get<3>());
+}
+
 MAKE_MULTIOPT(tuple_DO_set_value_EXPECT_same_value_with_get)
 MAKE_MULTIOPT(tuple_DO_set_array_EXPECT_same_value_with_get)
 MAKE_MULTIOPT(tuple_DO_iterate_throught_content_EXPECT_correct_raw_data)
 MAKE_MULTIOPT(tuple_DO_access_like_array_EXPECT_correct_raw_values)
 MAKE_MULTIOPT(tuple_DO_invoke_function_EXPECT_correct_behavior)
 MAKE_MULTIOPT(tuple_DO_make_empty_tuple_EXPECT_valid_object)
+MAKE_MULTIOPT(tuple_DO_assign_tuple_EXPECT_same_values)
 
 int main() {
   using namespace upd;
@@ -267,11 +305,13 @@ int main() {
   tuple_DO_access_like_array_EXPECT_correct_raw_values_multiopt(every_options);
   tuple_DO_invoke_function_EXPECT_correct_behavior_multiopt(every_options);
   tuple_DO_make_empty_tuple_EXPECT_valid_object_multiopt(every_options);
+  tuple_DO_assign_tuple_EXPECT_same_values_multiopt(every_options);
 
   UNITY_BEGIN();
   RUN_TEST(tuple_DO_bind_names_to_tuple_element_EXPECT_getting_same_values_cpp17);
   RUN_TEST(tuple_DO_serialize_user_provided_structure_EXCEPT_correct_behavior);
   RUN_TEST(tuple_DO_serialize_std_array);
+  RUN_TEST(tuple_DO_construct_uninitialized_tuple_EXPECT_values_from_copied_content);
   RUN_TEST(tuple_view_DO_iterate_subview_EXPECT_exact_subsequence);
   return UNITY_END();
 }
@@ -1,3 +1,9 @@
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include <upd/tuple.hpp>
 
 #include "utility.hpp"
@@ -96,6 +102,65 @@ static void tuple_view_DO_assign_to_a_tuple_EXPECT_correct_behavior() {
   TEST_ASSERT_TRUE(get<2>(lhs));
 }
 
+static void tuple_view_DO_decode_all_from_a_stream_EXPECT_stream_read_exactly_once() {
+  using namespace upd;
+
+  auto t = make_tuple(big_endian, ones_complement, std::int16_t{-0x123}, std::uint32_t{0xabcdef}, char{'x'});
+  std::istringstream stream{std::string{t.begin(), t.end()} + '!'};
+
+  auto values = make_view<std::int16_t, std::uint32_t, char>(big_endian, ones_complement,
+                                                             std::istreambuf_iterator<char>{stream})
+                    .decode_all();
+
+  TEST_ASSERT_EQUAL_INT16(-0x123, std::get<0>(values));
+  TEST_ASSERT_EQUAL_HEX32(0xabcdef, std::get<1>(values));
+  TEST_ASSERT_EQUAL_CHAR('x', std::get<2>(values));
+  TEST_ASSERT_EQUAL_CHAR('!', stream.get());
+}
+
+struct field_sum {
+  template<typename T>
+  void operator()(T value) {
+    sum += value;
+    count++;
+  }
+
+  template<typename T, std::size_t N>
+  void operator()(const std::array<T, N> &values) {
+    for (auto value : values)
+      (*this)(value);
+  }
+
+  long long sum;
+  int count;
+};
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void tuple_view_DO_iterate_over_fields_EXPECT_same_values_whatever_the_iterator() {
+  using namespace upd;
+
+  int array[] = {-1, 2, -3};
+  auto t = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, short{-4}, array, long{50});
+  std::list<byte_t> list{t.begin(), t.end()};
+  std::vector<byte_t> vector{t.begin(), t.end()};
+
+  field_sum from_list{0, 0}, from_vector{0, 0};
+  make_view<short, int[3], long>(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, list.cbegin())
+      .for_each_field(from_list);
+  make_view<short, int[3], long>(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, vector.cbegin())
+      .for_each_field(from_vector);
+
+  static_assert(detail::is_contiguous_byte_iterator<std::vector<byte_t>::const_iterator>::value, "");
+  static_assert(!detail::is_contiguous_byte_iterator<std::list<byte_t>::const_iterator>::value, "");
+  TEST_ASSERT_EQUAL_INT64(44, from_list.sum);
+  TEST_ASSERT_EQUAL_INT(5, from_list.count);
+  TEST_ASSERT_EQUAL_INT64(44, from_vector.sum);
+  TEST_ASSERT_EQUAL_INT(5, from_vector.count);
+  TEST_ASSERT_TRUE(t.decode_all() == std::make_tuple(short{-4}, std::array<int, 3>{{-1, 2, -3}}, long{50}));
+}
+
+MAKE_MULTIOPT(tuple_view_DO_iterate_over_fields_EXPECT_same_values_whatever_the_iterator)
+
 int main() {
   using namespace upd;
 
@@ -115,5 +180,7 @@ int main() {
   RUN_TEST(tuple_view_DO_set_value_EXPECT_reading_same_value);
   RUN_TEST(tuple_view_DO_bind_to_a_forward_list_EXPECT_correct_behavior);
   RUN_TEST(tuple_view_DO_assign_to_a_tuple_EXPECT_correct_behavior);
+  RUN_TEST(tuple_view_DO_decode_all_from_a_stream_EXPECT_stream_read_exactly_once);
+  tuple_view_DO_iterate_over_fields_EXPECT_same_values_whatever_the_iterator_multiopt(every_options);
   return UNITY_END();
 }
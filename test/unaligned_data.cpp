@@ -1,3 +1,7 @@
+#include <array>
+#include <cstdint>
+#include <limits>
+
 #include <upd/detail/serialization.hpp>
 
 #include "utility.hpp"
@@ -29,6 +33,40 @@ static void unaligned_data_DO_serialize_data_EXPECT_correct_value_when_unseriali
 
 MAKE_MULTIOPT(unaligned_data_DO_serialize_data_EXPECT_correct_value_when_unserializing)
 
+template<typename Int, upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void check_integer_array_serialization() {
+  using namespace upd;
+
+  // 37 elements, so that the SIMD loops and the scalar tail are both exercised
+  std::array<Int, 37> array;
+  for (std::size_t i = 0; i < array.size(); i++)
+    array[i] = static_cast<Int>((i * 0x9e3779b97f4a7c15ull) >> (64 - 8 * sizeof(Int)));
+  array[0] = 0;
+  array[1] = std::numeric_limits<Int>::max();
+  array[2] = std::numeric_limits<Int>::min() + 1;
+  array[3] = static_cast<Int>(-1);
+
+  byte_t expected[sizeof(array)], buf[sizeof(array) + 1];
+  for (std::size_t i = 0; i < array.size(); i++)
+    detail::write_as<Endianess, Signed_Mode>(array[i], expected + i * sizeof(Int));
+  detail::write_as<Endianess, Signed_Mode>(array, buf + 1);
+
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, buf + 1, sizeof(array));
+  TEST_ASSERT_TRUE((detail::read_as<std::array<Int, 37>, Endianess, Signed_Mode>(buf + 1) == array));
+}
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void unaligned_data_DO_serialize_integer_array_EXPECT_same_result_as_element_wise() {
+  check_integer_array_serialization<int16_t, Endianess, Signed_Mode>();
+  check_integer_array_serialization<uint16_t, Endianess, Signed_Mode>();
+  check_integer_array_serialization<int32_t, Endianess, Signed_Mode>();
+  check_integer_array_serialization<uint32_t, Endianess, Signed_Mode>();
+  check_integer_array_serialization<int64_t, Endianess, Signed_Mode>();
+  check_integer_array_serialization<uint64_t, Endianess, Signed_Mode>();
+}
+
+MAKE_MULTIOPT(unaligned_data_DO_serialize_integer_array_EXPECT_same_result_as_element_wise)
+
 int main() {
   using namespace upd;
 
@@ -132,5 +170,6 @@ int main() {
                                                                      0x44>));
 
   unaligned_data_DO_serialize_data_EXPECT_correct_value_when_unserializing_multiopt(every_options);
+  unaligned_data_DO_serialize_integer_array_EXPECT_same_result_as_element_wise_multiopt(every_options);
   return UNITY_END();
 }
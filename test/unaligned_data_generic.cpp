@@ -0,0 +1,4 @@
+// Same checks as `unaligned_data.cpp`, using the platform-agnostic serialization
+#define UPD_NO_PLATFORM_DETECTION
+
+#include "unaligned_data.cpp"
@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include <upd/buffered_dispatcher.hpp>
+#include <upd/dispatcher.hpp>
+#include <upd/keyring.hpp>
+#include <upd/tuple.hpp>
+#include <upd/varint.hpp>
+
+#include "utility.hpp"
+
+upd::varint<std::int64_t>
+add_offset(upd::varint<std::uint32_t> counter, std::int8_t tag, upd::varint<std::int32_t> offset) {
+  return static_cast<std::int64_t>(counter) * tag + offset;
+}
+
+constexpr auto kring =
+    upd::make_keyring(upd::make_flist(UPD_CTREF(add_offset)), upd::little_endian, upd::twos_complement);
+
+template<typename T>
+static void check_round_trip(T value, std::size_t expected_length) {
+  using namespace upd;
+
+  auto t = make_tuple(little_endian, twos_complement, varint<T>{value});
+  TEST_ASSERT_EQUAL_UINT(varint<T>::max_size, t.size);
+  TEST_ASSERT_EQUAL_UINT(expected_length, detail::wire_format<decltype(t)>::size(t.begin()));
+  TEST_ASSERT_TRUE(value == t.template get<0>().value());
+}
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void varint_DO_serialize_value_EXPECT_leb128_regardless_of_serialization_parameters() {
+  using namespace upd;
+
+  auto t = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, varint<std::uint32_t>{300},
+                      varint<std::int16_t>{-3});
+
+  TEST_ASSERT_EQUAL_HEX8(0xac, t.begin()[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x02, t.begin()[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x05, t.begin()[varint<std::uint32_t>::max_size]);
+  TEST_ASSERT_EQUAL_UINT32(300, t.template get<0>());
+  TEST_ASSERT_EQUAL_INT16(-3, t.template get<1>());
+}
+
+MAKE_MULTIOPT(varint_DO_serialize_value_EXPECT_leb128_regardless_of_serialization_parameters)
+
+static void varint_DO_serialize_extreme_values_EXPECT_same_values_and_bounded_length() {
+  check_round_trip<std::uint8_t>(0, 1);
+  check_round_trip<std::uint8_t>(0xff, 2);
+  check_round_trip<std::int8_t>(std::numeric_limits<std::int8_t>::min(), 2);
+  check_round_trip<std::int8_t>(-64, 1);
+  check_round_trip<std::int8_t>(64, 2);
+  check_round_trip<std::uint32_t>(127, 1);
+  check_round_trip<std::uint32_t>(128, 2);
+  check_round_trip<std::int32_t>(std::numeric_limits<std::int32_t>::min(), 5);
+  check_round_trip<std::int32_t>(std::numeric_limits<std::int32_t>::max(), 5);
+  check_round_trip<std::uint64_t>(std::numeric_limits<std::uint64_t>::max(), 10);
+  check_round_trip<std::int64_t>(std::numeric_limits<std::int64_t>::min(), 10);
+  check_round_trip<std::int64_t>(-1, 1);
+}
+
+static void varint_DO_send_small_values_EXPECT_short_request_and_same_result() {
+  using namespace upd;
+
+  auto k = kring.get(UPD_CTREF(add_offset));
+  auto dis = make_dispatcher(kring, policy::any_callback);
+  byte_t packet[k.payload_length], response[16], *ptr = packet;
+
+  auto message = k(7, std::int8_t{-3}, -20);
+  TEST_ASSERT_EQUAL_UINT(1 + 1 + 1 + 1, message.size());
+  message.write_to(packet);
+
+  std::size_t written = 0;
+  dis([&]() { return *ptr++; }, [&](byte_t byte) { response[written++] = byte; });
+  TEST_ASSERT_EQUAL_UINT(message.size(), ptr - packet);
+  TEST_ASSERT_EQUAL_UINT(1, written);
+
+  ptr = response;
+  TEST_ASSERT_EQUAL_INT64(-41, k.read_from([&]() { return *ptr++; }));
+  TEST_ASSERT_EQUAL_INT(1, ptr - response);
+}
+
+static void varint_DO_encode_request_in_place_EXPECT_same_bytes_as_streamed_request() {
+  using namespace upd;
+
+  auto k = kring.get(UPD_CTREF(add_offset));
+  byte_t streamed[k.payload_length], in_place[k.payload_length];
+  std::size_t size = 0;
+
+  k.write([&](byte_t byte) { streamed[size++] = byte; }, 1000000, std::int8_t{1}, -100000);
+  TEST_ASSERT_EQUAL_UINT(size, k.encode_into(in_place, 1000000, std::int8_t{1}, -100000));
+  TEST_ASSERT_EQUAL_UINT(1 + 3 + 1 + 3, size);
+  TEST_ASSERT_TRUE(std::equal(streamed, streamed + size, in_place));
+}
+
+static void varint_DO_put_packets_back_to_back_EXPECT_each_packet_framed() {
+  using namespace upd;
+
+  auto k = kring.get(UPD_CTREF(add_offset));
+  auto dis = make_double_buffered_dispatcher(kring, policy::any_callback);
+  byte_t packets[2 * k.payload_length], result[16];
+  std::size_t size = k.encode_into(packets, 5, std::int8_t{2}, 1);
+  size += k.encode_into(packets + size, 300000, std::int8_t{-1}, 0);
+
+  for (std::size_t i = 0; i < size;) {
+    auto put = dis.put(packets + i, size - i);
+    i += put.consumed;
+    TEST_ASSERT_EQUAL_UINT(1, put.resolved);
+
+    dis.write_to(result);
+    TEST_ASSERT_EQUAL_INT64(i == size ? -300000 : 11, k.read_from(result));
+  }
+
+  for (std::size_t i = 0; i < size; i++) {
+    auto status = dis.put(packets[i]);
+    if (status == packet_status::RESOLVED_PACKET)
+      dis.write_to(result);
+  }
+  TEST_ASSERT_EQUAL_INT64(-300000, k.read_from(result));
+
+  batch_entry entries[4];
+  byte_t batch_output[32];
+  auto batch = dis.dispatch_batch(packets, size, batch_output, sizeof batch_output, entries, 4);
+  TEST_ASSERT_EQUAL_UINT(size, batch.consumed);
+  TEST_ASSERT_EQUAL_UINT(2, batch.count);
+  TEST_ASSERT_EQUAL_INT64(11, k.read_from(batch_output + entries[0].offset));
+  TEST_ASSERT_EQUAL_INT64(-300000, k.read_from(batch_output + entries[1].offset));
+
+  batch = dis.dispatch_batch(packets, size - 1, batch_output, sizeof batch_output, entries, 4);
+  TEST_ASSERT_EQUAL_UINT(1, batch.count);
+}
+
+int main() {
+  UNITY_BEGIN();
+  varint_DO_serialize_value_EXPECT_leb128_regardless_of_serialization_parameters_multiopt(every_options);
+  RUN_TEST(varint_DO_serialize_extreme_values_EXPECT_same_values_and_bounded_length);
+  RUN_TEST(varint_DO_send_small_values_EXPECT_short_request_and_same_result);
+  RUN_TEST(varint_DO_encode_request_in_place_EXPECT_same_bytes_as_streamed_request);
+  RUN_TEST(varint_DO_put_packets_back_to_back_EXPECT_each_packet_framed);
+  return UNITY_END();
+}